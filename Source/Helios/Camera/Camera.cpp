@@ -40,6 +40,15 @@ Camera::Camera()
 	fov = 45;
 	near_plane = 0.01;
 	far_plane = 2000;
+
+    //Cameras are created before the context, the buffer is created when first written
+    uniform_buffer = 0;
+}
+
+Camera::~Camera()
+{
+    if(uniform_buffer != 0 && glfwGetCurrentContext() != NULL)
+        GL_State::delete_buffers(1, &uniform_buffer);
 }
 
 void Camera::rotateH(float angle)
@@ -53,11 +62,59 @@ void Camera::rotateV(float angle)
     forward = rotate(forward, angle, side);
 }
 
+Camera_Uniforms Camera::getUniforms()
+{
+    Camera_Uniforms uniforms;
+    uniforms.view = getViewMatrix();
+    uniforms.projection = getPerspectiveMatrix();
+    uniforms.view_projection = uniforms.projection*uniforms.view;
+    uniforms.inverse_view = inverse(uniforms.view);
+    uniforms.inverse_projection = inverse(uniforms.projection);
+    uniforms.inverse_view_projection = inverse(uniforms.view_projection);
+    uniforms.position = vec4(position, 1);
+    uniforms.viewport = vec4(width, height, near_plane, far_plane);
+    return uniforms;
+}
+
 void Camera::load_to_program(Shading_Program *program)
 {
-    program->load_uniform(getViewMatrix(), "view_m");
-    program->load_uniform(getPerspectiveMatrix(), "proj_m");
-    program->load_uniform(position, "camera_position");
+    //Hashed at compile time, loading them is a table lookup per uniform
+    static constexpr Uniform_Name view_uniform("view_m");
+    static constexpr Uniform_Name projection_uniform("proj_m");
+    static constexpr Uniform_Name position_uniform("camera_position");
+    //Shaders using the camera block have none of them
+    GLuint program_id = program->getProgramID();
+    GLint view = program->find_uniform(view_uniform);
+    GLint projection = program->find_uniform(projection_uniform);
+    GLint camera_position = program->find_uniform(position_uniform);
+    if(view != -1)
+        glProgramUniformMatrix4fv(program_id, view, 1, GL_FALSE,
+            value_ptr(getViewMatrix()));
+    if(projection != -1)
+        glProgramUniformMatrix4fv(program_id, projection, 1, GL_FALSE,
+            value_ptr(getPerspectiveMatrix()));
+    if(camera_position != -1)
+        glProgramUniform3fv(program_id, camera_position, 1, value_ptr(position));
+}
+
+void Camera::load_to_buffer()
+{
+    GL_State &state = GL_State::current();
+    Camera_Uniforms uniforms = getUniforms();
+    if(uniform_buffer == 0)
+    {
+        glGenBuffers(1, &uniform_buffer);
+        state.bind_buffer(GL_UNIFORM_BUFFER, uniform_buffer);
+        glObjectLabel(GL_BUFFER, uniform_buffer, -1, "\"Camera uniform buffer\"");
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(Camera_Uniforms), &uniforms,
+            GL_DYNAMIC_DRAW);
+    }
+    else
+    {
+        state.bind_buffer(GL_UNIFORM_BUFFER, uniform_buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Camera_Uniforms), &uniforms);
+    }
+    state.bind_buffer_base(GL_UNIFORM_BUFFER, HELIOS_CAMERA_BINDING, uniform_buffer);
 }
 //########################################################################################
 
@@ -17,15 +17,54 @@
 
 #include "Helios/System-Libraries.hpp"
 #include "Helios-Wrappers.hpp"
+#include "Frustum-Culling.hpp"
 
 //########################################################################################
 
+/**
+ * @brief Uniform buffer binding point of the camera block written by
+ * Camera::load_to_buffer()
+ *
+*/
+#define HELIOS_CAMERA_BINDING 0
+
 //========================================================================================
 /*                                                                                      *
  *                                     Camera Class                                     *
  *                                                                                      */
 //========================================================================================
 namespace Helios {
+/**
+ * @brief Camera data shared by every program, as laid out in the std140 block
+ *
+ * Shaders declare it as:
+ *
+ * @code
+ * layout(std140, binding = 0) uniform Camera_Block
+ * {
+ *     mat4 view;
+ *     mat4 projection;
+ *     mat4 view_projection;
+ *     mat4 inverse_view;
+ *     mat4 inverse_projection;
+ *     mat4 inverse_view_projection;
+ *     vec4 position;  // xyz world space position
+ *     vec4 viewport;  // width, height, near plane, far plane
+ * } camera;
+ * @endcode
+*/
+struct Camera_Uniforms
+{
+    glm::mat4 view;                     //!< World to view space
+    glm::mat4 projection;               //!< View to clip space
+    glm::mat4 view_projection;          //!< World to clip space
+    glm::mat4 inverse_view;             //!< View to world space
+    glm::mat4 inverse_projection;       //!< Clip to view space
+    glm::mat4 inverse_view_projection;  //!< Clip to world space
+    glm::vec4 position;                 //!< World space position, w is unused
+    glm::vec4 viewport;                 //!< Width, height, near plane and far plane
+};
+
 class Camera
 {
     private:
@@ -40,18 +79,36 @@ class Camera
         glm::vec3 up;
         glm::vec3 side;
 
+        GLuint uniform_buffer;  //!< Buffer of the camera block, 0 until first written
+
     public:
         Camera();
+        /**
+         * @brief Delete the uniform buffer, if the context is still current
+         *
+        */
+        ~Camera();
+
+        Camera(const Camera&) = delete;
+        Camera &operator=(const Camera&) = delete;
 
         glm::mat4 inline getViewMatrix(){
             return glm::lookAt(position, position+forward, up);}
 
         glm::mat4 getPerspectiveMatrix(){
             return glm::perspective(fov, width/height, near_plane, far_plane);}
+        Frustum inline getFrustum(){
+            return make_frustum(getPerspectiveMatrix()*getViewMatrix());}
 
         glm::vec3 inline getPosition(){return position;}
         glm::vec3 inline getForward(){return forward;}
         glm::vec3 inline getSide(){return side;}
+        float inline getHeight(){return height;}
+        /**
+         * @brief Get the data of the camera block
+         *
+        */
+        Camera_Uniforms getUniforms();
 
         void inline setPosition(glm::vec3 new_pos){position = new_pos;}
         void inline translate(glm::vec3 offset){position += offset;}
@@ -71,8 +128,20 @@ class Camera
         //TODO: perhaps these should be inline functions
         void rotateH(float angle);
         void rotateV(float angle);
-        //TODO: this may need to return an error checking code
+        /**
+         * @brief Load the camera into the view_m, proj_m and camera_position uniforms
+         *
+         * Kept for legacy shaders that do not declare the camera block, shaders that
+         * do use load_to_buffer() instead. Uniforms the program lacks are skipped.
+        */
         void load_to_program(Shading_Program *program);
+        /**
+         * @brief Write the camera block and bind it at HELIOS_CAMERA_BINDING
+         *
+         * Called once per frame, it replaces a load_to_program() per program for the
+         * shaders that declare the block.
+        */
+        void load_to_buffer();
 };
 
 }//Close Helios namespace
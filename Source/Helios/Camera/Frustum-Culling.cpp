@@ -0,0 +1,283 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of bounding volumes and batched view frustum culling
+ *
+ * @file Frustum-Culling.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Frustum-Culling.hpp"
+#include "Meshlets.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HELIOS_X86_CULLING
+#endif
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Signature of the culling kernels
+ *
+ * Every kernel tests the spheres in [first, count) and writes the indices of the
+ * visible ones starting at output.
+ *
+ * @return uint* One past the last index written
+*/
+typedef uint *(*Culling_Kernel)(const Helios::Sphere_Set &spheres,
+    const Helios::Frustum &frustum, uint first, uint count, uint *output);
+
+//Test spheres one at a time
+uint static *cull_scalar(const Helios::Sphere_Set &spheres,
+    const Helios::Frustum &frustum, uint first, uint count, uint *output)
+{
+    const float *x = spheres.getX(), *y = spheres.getY(), *z = spheres.getZ();
+    const float *radius = spheres.getRadius();
+    for(uint i=first; i<count; i++)
+    {
+        bool inside = true;
+        for(int p=0; p<6 && inside; p++)
+        {
+            const vec4 &plane = frustum.planes[p];
+            inside = plane.x*x[i] + plane.y*y[i] + plane.z*z[i] + plane.w >= -radius[i];
+        }
+        if(inside)
+            *(output++) = i;
+    }
+    return output;
+}
+
+#ifdef HELIOS_X86_CULLING
+//Test spheres four at a time
+__attribute__((target("sse2")))
+uint static *cull_sse(const Helios::Sphere_Set &spheres, const Helios::Frustum &frustum,
+    uint first, uint count, uint *output)
+{
+    const float *x = spheres.getX(), *y = spheres.getY(), *z = spheres.getZ();
+    const float *radius = spheres.getRadius();
+    __m128 planes[6][4];
+    for(int p=0; p<6; p++)
+        for(int c=0; c<4; c++)
+            planes[p][c] = _mm_set1_ps(frustum.planes[p][c]);
+
+    uint i = first;
+    for(; i+4<=count; i+=4)
+    {
+        __m128 sx = _mm_loadu_ps(x+i), sy = _mm_loadu_ps(y+i), sz = _mm_loadu_ps(z+i);
+        __m128 negative_radius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius+i));
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for(int p=0; p<6; p++)
+        {
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(planes[p][0], sx), _mm_mul_ps(planes[p][1], sy)),
+                _mm_add_ps(_mm_mul_ps(planes[p][2], sz), planes[p][3]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negative_radius));
+        }
+        //One bit per visible sphere
+        for(uint mask = _mm_movemask_ps(inside); mask; mask &= mask-1)
+            *(output++) = i + __builtin_ctz(mask);
+    }
+    return cull_scalar(spheres, frustum, i, count, output);
+}
+//Test spheres eight at a time
+__attribute__((target("avx2")))
+uint static *cull_avx2(const Helios::Sphere_Set &spheres, const Helios::Frustum &frustum,
+    uint first, uint count, uint *output)
+{
+    const float *x = spheres.getX(), *y = spheres.getY(), *z = spheres.getZ();
+    const float *radius = spheres.getRadius();
+    __m256 planes[6][4];
+    for(int p=0; p<6; p++)
+        for(int c=0; c<4; c++)
+            planes[p][c] = _mm256_set1_ps(frustum.planes[p][c]);
+
+    uint i = first;
+    for(; i+8<=count; i+=8)
+    {
+        __m256 sx = _mm256_loadu_ps(x+i), sy = _mm256_loadu_ps(y+i);
+        __m256 sz = _mm256_loadu_ps(z+i);
+        __m256 negative_radius = _mm256_sub_ps(_mm256_setzero_ps(),
+            _mm256_loadu_ps(radius+i));
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for(int p=0; p<6; p++)
+        {
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(planes[p][0], sx),
+                _mm256_mul_ps(planes[p][1], sy));
+            distance = _mm256_add_ps(distance,
+                _mm256_add_ps(_mm256_mul_ps(planes[p][2], sz), planes[p][3]));
+            inside = _mm256_and_ps(inside,
+                _mm256_cmp_ps(distance, negative_radius, _CMP_GE_OQ));
+        }
+        for(uint mask = _mm256_movemask_ps(inside); mask; mask &= mask-1)
+            *(output++) = i + __builtin_ctz(mask);
+    }
+    return cull_sse(spheres, frustum, i, count, output);
+}
+#endif
+/**
+ * @brief Pick the fastest kernel the CPU supports
+ *
+ * @param path Where to store which kernel was picked
+ * @return Culling_Kernel The kernel
+*/
+Culling_Kernel static select_kernel(Helios::Culling_Path &path)
+{
+#ifdef HELIOS_X86_CULLING
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+    {
+        path = Helios::HELIOS_CULLING_AVX2;
+        return cull_avx2;
+    }
+    if(__builtin_cpu_supports("sse2"))
+    {
+        path = Helios::HELIOS_CULLING_SSE;
+        return cull_sse;
+    }
+#endif
+    path = Helios::HELIOS_CULLING_SCALAR;
+    return cull_scalar;
+}
+//Kernel used by cull_spheres(), chosen the first time it is needed
+Culling_Kernel static kernel(Helios::Culling_Path *path = NULL)
+{
+    static Helios::Culling_Path selected_path;
+    static const Culling_Kernel selected = select_kernel(selected_path);
+    if(path)
+        *path = selected_path;
+    return selected;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Sphere Set Class                                   *
+ *                                                                                      */
+//========================================================================================
+
+uint Sphere_Set::add(vec3 center, float sphere_radius)
+{
+    x.push_back(center.x);
+    y.push_back(center.y);
+    z.push_back(center.z);
+    radius.push_back(sphere_radius);
+    return x.size() - 1;
+}
+
+void Sphere_Set::clear()
+{
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Build the planes of a view volume
+Frustum make_frustum(const mat4 &matrix)
+{
+    Frustum frustum;
+    extract_frustum_planes(matrix, frustum.planes);
+    return frustum;
+}
+
+//Ritter's bounding sphere
+void bounding_sphere(const vector<vec3> &points, vec3 &center, float &radius)
+{
+    center = vec3(0);
+    radius = 0;
+    if(points.empty())
+        return;
+
+    //Start from two far apart points: the farthest from a point and the farthest from it
+    vec3 a = points[0], b = points[0];
+    for(const vec3 &p : points)
+        if(distance(p, points[0]) > distance(a, points[0]))
+            a = p;
+    for(const vec3 &p : points)
+        if(distance(p, a) > distance(b, a))
+            b = p;
+    center = (a + b)*0.5f;
+    radius = distance(a, b)*0.5f;
+
+    //Grow the sphere just enough to include every point outside of it
+    for(const vec3 &p : points)
+    {
+        float d = distance(p, center);
+        if(d <= radius)
+            continue;
+        float grown = (radius + d)*0.5f;
+        center += (p - center)*((grown - radius)/d);
+        radius = grown;
+    }
+
+    //The sphere around the center of the bounding box is sometimes tighter
+    vec3 box_min = points[0], box_max = points[0];
+    for(const vec3 &p : points)
+    {
+        box_min = glm::min(box_min, p);
+        box_max = glm::max(box_max, p);
+    }
+    vec3 box_center = (box_min + box_max)*0.5f;
+    float box_radius = 0;
+    for(const vec3 &p : points)
+        box_radius = glm::max(box_radius, distance(p, box_center));
+    if(box_radius < radius)
+    {
+        center = box_center;
+        radius = box_radius;
+    }
+}
+
+//Transform a sphere
+void transform_sphere(const mat4 &model, vec3 &center, float &radius)
+{
+    center = vec3(model*vec4(center, 1));
+    float scale = glm::max(length(vec3(model[0])),
+        glm::max(length(vec3(model[1])), length(vec3(model[2]))));
+    radius *= scale;
+}
+
+//Batched sphere culling
+uint cull_spheres(const Sphere_Set &spheres, const Frustum &frustum,
+    vector<uint> &visible)
+{
+    visible.resize(spheres.size());
+    uint *end = kernel()(spheres, frustum, 0, spheres.size(), visible.data());
+    visible.resize(end - visible.data());
+    return visible.size();
+}
+
+//Culling kernel in use
+Culling_Path culling_path()
+{
+    Culling_Path path;
+    kernel(&path);
+    return path;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
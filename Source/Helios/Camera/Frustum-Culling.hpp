@@ -0,0 +1,172 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of bounding volumes and batched view frustum culling
+ *
+ * @file Frustum-Culling.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Implementation used by cull_spheres(), picked once from the running CPU
+ *
+*/
+enum Culling_Path {HELIOS_CULLING_SCALAR = 0, HELIOS_CULLING_SSE, HELIOS_CULLING_AVX2};
+
+/**
+ * @brief The six planes bounding a view volume
+ *
+ * Planes are stored as (normal, offset) with unit normals pointing inside the volume,
+ * in the order left, right, bottom, top, near, far.
+*/
+struct Frustum
+{
+    glm::vec4 planes[6];    //!< The bounding planes
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Bounding spheres stored as a structure of arrays
+ *
+ * Each coordinate is kept in its own array so the culling kernels load 4 or 8 spheres
+ * with one instruction per component.
+*/
+class Sphere_Set
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        std::vector<float> x;       //!< X coordinates of the centers
+        std::vector<float> y;       //!< Y coordinates of the centers
+        std::vector<float> z;       //!< Z coordinates of the centers
+        std::vector<float> radius;  //!< Radii of the spheres
+
+    public:
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of spheres in the set
+         *
+        */
+        uint inline size() const {return x.size();}
+        ///@{
+        /**
+         * @brief Get one component array of the set
+         *
+        */
+        const float inline *getX() const {return x.data();}
+        const float inline *getY() const {return y.data();}
+        const float inline *getZ() const {return z.data();}
+        const float inline *getRadius() const {return radius.data();}
+        ///@}
+        /**
+         * @brief Move a sphere of the set
+         *
+         * @param index Index returned by add()
+         * @param center New center of the sphere
+         * @param sphere_radius New radius of the sphere
+        */
+        void inline set(uint index, glm::vec3 center, float sphere_radius)
+        {
+            x[index] = center.x;
+            y[index] = center.y;
+            z[index] = center.z;
+            radius[index] = sphere_radius;
+        }
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Add a sphere to the set
+         *
+         * @param center Center of the sphere
+         * @param sphere_radius Radius of the sphere
+         * @return uint Index of the sphere, reported by cull_spheres() when visible
+        */
+        uint add(glm::vec3 center, float sphere_radius);
+        /**
+         * @brief Remove every sphere from the set
+         *
+        */
+        void clear();
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Build the frustum of a transformation to clip space
+ *
+ * @param matrix A projection*view matrix gives world space planes, a
+ *        projection*view*model matrix gives planes in the object space of the model
+ * @return Frustum The view volume
+*/
+Frustum make_frustum(const glm::mat4 &matrix);
+/**
+ * @brief Compute a sphere enclosing a set of points
+ *
+ * Uses Ritter's algorithm and keeps the result if it is smaller than the sphere around
+ * the center of the bounding box, it is usually within a few percent of the optimum.
+ *
+ * @param points The points to enclose
+ * @param center Where to store the center of the sphere
+ * @param radius Where to store the radius of the sphere, 0 if there are no points
+*/
+void bounding_sphere(const std::vector<glm::vec3> &points, glm::vec3 &center,
+    float &radius);
+/**
+ * @brief Transform a bounding sphere, keeping it enclosing under non uniform scales
+ *
+ * @param model The transformation
+ * @param center Center of the sphere, replaced by the transformed center
+ * @param radius Radius of the sphere, replaced by the transformed radius
+*/
+void transform_sphere(const glm::mat4 &model, glm::vec3 &center, float &radius);
+/**
+ * @brief Find the spheres that intersect a frustum
+ *
+ * Spheres are tested 8 at a time with AVX2, 4 at a time with SSE, or one at a time if
+ * neither is available. The test is conservative: spheres near the corners of the
+ * frustum may be reported visible while being outside of it.
+ *
+ * @param spheres The spheres to test
+ * @param frustum The view volume, in the same space as the spheres
+ * @param visible Filled with the indices of the visible spheres, in increasing order
+ * @return uint The number of visible spheres
+*/
+uint cull_spheres(const Sphere_Set &spheres, const Frustum &frustum,
+    std::vector<uint> &visible);
+/**
+ * @brief Get the implementation used by cull_spheres() on this CPU
+ *
+*/
+Culling_Path culling_path();
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,509 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of a bounding volume hierarchy over placed mesh instances
+ *
+ * @file Scene-BVH.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Scene-BVH.hpp"
+
+#include <limits>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Subtrees with more objects than this are built on their own task
+ *
+*/
+#define BVH_TASK_THRESHOLD 4096
+
+//Largest float, starting value of the boxes grown while building
+static const float float_max = numeric_limits<float>::max();
+
+/**
+ * @brief Find the bin of a centroid along the split axis
+ *
+ * @param value Coordinate of the centroid along the axis
+ * @param axis_min Smallest centroid coordinate of the node along the axis
+ * @param bin_scale Number of bins divided by the extent of the centroids along the axis
+ * @return int The bin, in [0, HELIOS_BVH_BINS)
+*/
+int static bin_of(float value, float axis_min, float bin_scale)
+{
+    return std::min(int((value - axis_min)*bin_scale), HELIOS_BVH_BINS - 1);
+}
+/**
+ * @brief Half the surface area of a box, enough to compare the cost of splits
+ *
+ * @param extent Size of the box along every axis
+ * @return float The half area, 0 for empty boxes
+*/
+float static half_area(vec3 extent)
+{
+    extent = glm::max(extent, vec3(0));
+    return extent.x*extent.y + extent.y*extent.z + extent.z*extent.x;
+}
+/**
+ * @brief Compute the distance along a ray at which it enters a box
+ *
+ * @param bounds_min Minimum corner of the box
+ * @param bounds_max Maximum corner of the box
+ * @param origin Origin of the ray
+ * @param inverse_direction Component wise inverse of the direction of the ray
+ * @param max_distance Hits further than this are ignored
+ * @return float The entry distance, 0 if the origin is inside the box, infinity if the
+ *         ray misses the box
+*/
+float static ray_box(vec3 bounds_min, vec3 bounds_max, vec3 origin,
+    vec3 inverse_direction, float max_distance)
+{
+    vec3 t0 = (bounds_min - origin)*inverse_direction;
+    vec3 t1 = (bounds_max - origin)*inverse_direction;
+    vec3 entries = glm::min(t0, t1), exits = glm::max(t0, t1);
+    float enter = glm::max(glm::max(entries.x, entries.y), glm::max(entries.z, 0.f));
+    float exit = glm::min(glm::min(exits.x, exits.y), glm::min(exits.z, max_distance));
+    return enter <= exit? enter : numeric_limits<float>::infinity();
+}
+/**
+ * @brief Test a box against the planes of a frustum
+ *
+ * @param bounds_min Minimum corner of the box
+ * @param bounds_max Maximum corner of the box
+ * @param frustum The frustum
+ * @param planes Bit mask of the planes to test, the planes the box is fully inside of are
+ *        removed from it
+ * @return bool False if the box is fully outside of one of the planes
+*/
+bool static box_in_frustum(vec3 bounds_min, vec3 bounds_max,
+    const Helios::Frustum &frustum, uint &planes)
+{
+    vec3 center = (bounds_min + bounds_max)*0.5f;
+    vec3 half_extent = (bounds_max - bounds_min)*0.5f;
+    for(int p=0; p<6; p++)
+    {
+        if(!(planes & (1 << p)))
+            continue;
+        vec3 normal = vec3(frustum.planes[p]);
+        float distance = dot(normal, center) + frustum.planes[p].w;
+        float reach = dot(abs(normal), half_extent);
+        if(distance + reach < 0)
+            return false;
+        //Everything inside the box is on the inner side of this plane
+        if(distance - reach >= 0)
+            planes &= ~(1 << p);
+    }
+    return true;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Scene BVH Class                                   *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Scene_BVH::Scene_BVH()
+{
+    built_area = 0;
+    area = 0;
+    built = true;
+}
+
+//──── Building ──────────────────────────────────────────────────────────────────────────
+
+uint Scene_BVH::insert(vec3 bounds_min, vec3 bounds_max)
+{
+    uint object = slots.size();
+    slots.push_back(objects.size());
+    objects.push_back({bounds_min, object, bounds_max, 0});
+    built = false;
+    return object;
+}
+
+uint Scene_BVH::insert(Mesh &mesh, const mat4 &model)
+{
+    vec3 bounds_min = mesh.getBoundsMin(), bounds_max = mesh.getBoundsMax();
+    transform_box(model, bounds_min, bounds_max);
+    return insert(bounds_min, bounds_max);
+}
+
+void Scene_BVH::update(uint object, vec3 bounds_min, vec3 bounds_max)
+{
+    BVH_Object &box = objects[slots[object]];
+    box.bounds_min = bounds_min;
+    box.bounds_max = bounds_max;
+    moved.push_back(object);
+}
+
+void Scene_BVH::update(uint object, Mesh &mesh, const mat4 &model)
+{
+    vec3 bounds_min = mesh.getBoundsMin(), bounds_max = mesh.getBoundsMax();
+    transform_box(model, bounds_min, bounds_max);
+    update(object, bounds_min, bounds_max);
+}
+
+void Scene_BVH::build()
+{
+    uint object_count = objects.size();
+    nodes.clear();
+    parents.clear();
+    moved.clear();
+    built = true;
+    built_area = area = 0;
+    if(object_count == 0)
+        return;
+
+    //A binary tree with at least one object per leaf has less than 2n nodes
+    nodes.resize(2*object_count - 1);
+    parents.resize(nodes.size());
+    nodes[0].first = 0;
+    nodes[0].count = object_count;
+    parents[0] = 0;
+    atomic<uint> node_count(1);
+    #pragma omp parallel
+    #pragma omp single
+    build_node(0, node_count);
+    nodes.resize(node_count);
+    parents.resize(node_count);
+
+    for(uint n=0; n<nodes.size(); n++)
+    {
+        area += half_area(nodes[n].bounds_max - nodes[n].bounds_min);
+        for(uint i=nodes[n].first; i<nodes[n].first+nodes[n].count; i++)
+        {
+            objects[i].leaf = n;
+            slots[objects[i].object] = i;
+        }
+    }
+    built_area = area;
+}
+
+void Scene_BVH::build_node(uint node, atomic<uint> &node_count)
+{
+    uint first = nodes[node].first, count = nodes[node].count;
+    BVH_Object *begin = objects.data() + first, *end = begin + count;
+
+    //Bounds of the objects and of their centroids
+    vec3 bounds_min(float_max), bounds_max(-float_max);
+    vec3 centroid_min = bounds_min, centroid_max = bounds_max;
+    for(BVH_Object *box=begin; box<end; box++)
+    {
+        bounds_min = glm::min(bounds_min, box->bounds_min);
+        bounds_max = glm::max(bounds_max, box->bounds_max);
+        vec3 centroid = (box->bounds_min + box->bounds_max)*0.5f;
+        centroid_min = glm::min(centroid_min, centroid);
+        centroid_max = glm::max(centroid_max, centroid);
+    }
+    nodes[node].bounds_min = bounds_min;
+    nodes[node].bounds_max = bounds_max;
+    if(count <= HELIOS_BVH_LEAF_SIZE)
+        return;
+
+    //Evaluate the planes between bins along every axis, keep the cheapest split
+    vec3 extent = centroid_max - centroid_min;
+    float best_cost = float_max;
+    int best_axis = -1, best_split = 0;
+    for(int axis=0; axis<3; axis++)
+    {
+        if(extent[axis] <= 0)
+            continue;
+        uint bin_counts[HELIOS_BVH_BINS] = {};
+        vec3 bin_min[HELIOS_BVH_BINS], bin_max[HELIOS_BVH_BINS];
+        fill(bin_min, bin_min + HELIOS_BVH_BINS, vec3(float_max));
+        fill(bin_max, bin_max + HELIOS_BVH_BINS, vec3(-float_max));
+        float bin_scale = HELIOS_BVH_BINS/extent[axis];
+        for(BVH_Object *box=begin; box<end; box++)
+        {
+            float centroid = (box->bounds_min[axis] + box->bounds_max[axis])*0.5f;
+            int bin = bin_of(centroid, centroid_min[axis], bin_scale);
+            bin_counts[bin]++;
+            bin_min[bin] = glm::min(bin_min[bin], box->bounds_min);
+            bin_max[bin] = glm::max(bin_max[bin], box->bounds_max);
+        }
+
+        //Sweep from the right to get the cost of every right side, then from the left
+        float right_costs[HELIOS_BVH_BINS];
+        vec3 sweep_min(float_max), sweep_max(-float_max);
+        uint sweep_count = 0;
+        for(int bin=HELIOS_BVH_BINS-1; bin>0; bin--)
+        {
+            sweep_min = glm::min(sweep_min, bin_min[bin]);
+            sweep_max = glm::max(sweep_max, bin_max[bin]);
+            sweep_count += bin_counts[bin];
+            right_costs[bin] = sweep_count*half_area(sweep_max - sweep_min);
+        }
+        sweep_min = vec3(float_max);
+        sweep_max = vec3(-float_max);
+        sweep_count = 0;
+        for(int bin=0; bin<HELIOS_BVH_BINS-1; bin++)
+        {
+            sweep_min = glm::min(sweep_min, bin_min[bin]);
+            sweep_max = glm::max(sweep_max, bin_max[bin]);
+            sweep_count += bin_counts[bin];
+            float cost = sweep_count*half_area(sweep_max - sweep_min) +
+                right_costs[bin+1];
+            if(sweep_count > 0 && sweep_count < count && cost < best_cost)
+            {
+                best_cost = cost;
+                best_axis = axis;
+                best_split = bin + 1;
+            }
+        }
+    }
+
+    //Objects sharing one centroid cannot be binned, they are split in halves
+    BVH_Object *middle = begin + count/2;
+    if(best_axis >= 0)
+    {
+        float bin_scale = HELIOS_BVH_BINS/extent[best_axis];
+        float axis_min = centroid_min[best_axis];
+        middle = partition(begin, end, [&](const BVH_Object &box)
+            {
+                float centroid = box.bounds_min[best_axis] + box.bounds_max[best_axis];
+                return bin_of(centroid*0.5f, axis_min, bin_scale) < best_split;
+            });
+    }
+    uint left_count = middle - begin;
+
+    //Children are always allocated after their parent, refit() relies on it
+    uint children = node_count.fetch_add(2);
+    nodes[children].first = first;
+    nodes[children].count = left_count;
+    nodes[children + 1].first = first + left_count;
+    nodes[children + 1].count = count - left_count;
+    parents[children] = parents[children + 1] = node;
+    nodes[node].first = children;
+    nodes[node].count = 0;
+
+    if(count > BVH_TASK_THRESHOLD)
+    {
+        #pragma omp task shared(node_count)
+        build_node(children, node_count);
+    }
+    else
+        build_node(children, node_count);
+    build_node(children + 1, node_count);
+}
+
+void Scene_BVH::refit()
+{
+    if(!built)
+    {
+        build();
+        return;
+    }
+    if(moved.empty())
+        return;
+
+    //Mark the leaves of the moved objects and their ancestors
+    vector<bool> dirty(nodes.size(), false);
+    vector<uint> dirty_nodes;
+    for(uint object : moved)
+    {
+        uint node = objects[slots[object]].leaf;
+        while(!dirty[node])
+        {
+            dirty[node] = true;
+            dirty_nodes.push_back(node);
+            if(node == 0)
+                break;
+            node = parents[node];
+        }
+    }
+    moved.clear();
+
+    //Children come after their parents, so updating in reverse order visits them first
+    sort(dirty_nodes.begin(), dirty_nodes.end(), greater<uint>());
+    for(uint node : dirty_nodes)
+    {
+        BVH_Node &n = nodes[node];
+        area -= half_area(n.bounds_max - n.bounds_min);
+        if(n.count > 0)
+        {
+            n.bounds_min = objects[n.first].bounds_min;
+            n.bounds_max = objects[n.first].bounds_max;
+            for(uint i=n.first+1; i<n.first+n.count; i++)
+            {
+                n.bounds_min = glm::min(n.bounds_min, objects[i].bounds_min);
+                n.bounds_max = glm::max(n.bounds_max, objects[i].bounds_max);
+            }
+        }
+        else
+        {
+            const BVH_Node &left = nodes[n.first], &right = nodes[n.first + 1];
+            n.bounds_min = glm::min(left.bounds_min, right.bounds_min);
+            n.bounds_max = glm::max(left.bounds_max, right.bounds_max);
+        }
+        area += half_area(n.bounds_max - n.bounds_min);
+    }
+}
+
+void Scene_BVH::clear()
+{
+    nodes.clear();
+    parents.clear();
+    objects.clear();
+    slots.clear();
+    moved.clear();
+    built_area = area = 0;
+    built = true;
+}
+
+//──── Queries ───────────────────────────────────────────────────────────────────────────
+
+uint Scene_BVH::cull(const Frustum &frustum, vector<uint> &visible)
+{
+    visible.clear();
+    refit();
+    if(nodes.empty())
+        return 0;
+
+    //Every entry is a node and the planes it still has to be tested against
+    const uint all_planes = (1 << 6) - 1;
+    vector<pair<uint, uint>> stack = {{0, all_planes}};
+    while(!stack.empty())
+    {
+        uint node = stack.back().first, planes = stack.back().second;
+        stack.pop_back();
+        const BVH_Node &n = nodes[node];
+        if(!box_in_frustum(n.bounds_min, n.bounds_max, frustum, planes))
+            continue;
+
+        if(planes == 0)
+        {
+            //The objects of a subtree are contiguous in the leaf order
+            uint left = node, right = node;
+            while(nodes[left].count == 0)
+                left = nodes[left].first;
+            while(nodes[right].count == 0)
+                right = nodes[right].first + 1;
+            for(uint i=nodes[left].first; i<nodes[right].first+nodes[right].count; i++)
+                visible.push_back(objects[i].object);
+        }
+        else if(n.count > 0)
+        {
+            for(uint i=n.first; i<n.first+n.count; i++)
+            {
+                uint object_planes = planes;
+                if(box_in_frustum(objects[i].bounds_min, objects[i].bounds_max, frustum,
+                    object_planes))
+                    visible.push_back(objects[i].object);
+            }
+        }
+        else
+        {
+            stack.push_back({n.first + 1, planes});
+            stack.push_back({n.first, planes});
+        }
+    }
+    return visible.size();
+}
+
+int Scene_BVH::raycast(vec3 origin, vec3 direction, float &distance,
+    const function<bool(uint, float&)> &hit_test)
+{
+    distance = numeric_limits<float>::infinity();
+    refit();
+    if(nodes.empty())
+        return -1;
+
+    vec3 inverse_direction = 1.f/direction;
+    int closest = -1;
+    float root = ray_box(nodes[0].bounds_min, nodes[0].bounds_max, origin,
+        inverse_direction, distance);
+    if(root == numeric_limits<float>::infinity())
+        return -1;
+
+    vector<pair<uint, float>> stack = {{0, root}};
+    while(!stack.empty())
+    {
+        uint node = stack.back().first;
+        float enter = stack.back().second;
+        stack.pop_back();
+        if(enter >= distance)
+            continue;
+
+        const BVH_Node &n = nodes[node];
+        if(n.count > 0)
+        {
+            for(uint i=n.first; i<n.first+n.count; i++)
+            {
+                const BVH_Object &box = objects[i];
+                float hit = ray_box(box.bounds_min, box.bounds_max, origin,
+                    inverse_direction, distance);
+                if(hit >= distance)
+                    continue;
+                if(hit_test && !hit_test(box.object, hit))
+                    continue;
+                if(hit < distance)
+                {
+                    distance = hit;
+                    closest = box.object;
+                }
+            }
+            continue;
+        }
+
+        //Push the farther child first so the nearer one is visited next
+        uint near_node = n.first, far_node = n.first + 1;
+        float near_hit = ray_box(nodes[near_node].bounds_min, nodes[near_node].bounds_max,
+            origin, inverse_direction, distance);
+        float far_hit = ray_box(nodes[far_node].bounds_min, nodes[far_node].bounds_max,
+            origin, inverse_direction, distance);
+        if(far_hit < near_hit)
+        {
+            swap(near_hit, far_hit);
+            swap(near_node, far_node);
+        }
+        if(far_hit < distance)
+            stack.push_back({far_node, far_hit});
+        if(near_hit < distance)
+            stack.push_back({near_node, near_hit});
+    }
+    return closest;
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Arvo's transformation of a box
+void transform_box(const mat4 &model, vec3 &bounds_min, vec3 &bounds_max)
+{
+    vec3 new_min = vec3(model[3]), new_max = new_min;
+    for(int column=0; column<3; column++)
+    {
+        vec3 a = vec3(model[column])*bounds_min[column];
+        vec3 b = vec3(model[column])*bounds_max[column];
+        new_min += glm::min(a, b);
+        new_max += glm::max(a, b);
+    }
+    bounds_min = new_min;
+    bounds_max = new_max;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
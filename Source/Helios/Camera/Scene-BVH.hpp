@@ -0,0 +1,247 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of a bounding volume hierarchy over placed mesh instances
+ *
+ * @file Scene-BVH.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Camera.hpp"
+#include "Frustum-Culling.hpp"
+
+#include <atomic>
+#include <functional>
+//########################################################################################
+
+/**
+ * @brief Maximum number of objects stored in a leaf of a Scene_BVH
+ *
+*/
+#define HELIOS_BVH_LEAF_SIZE 4
+/**
+ * @brief Number of bins along the split axis when evaluating the surface area heuristic
+ *
+*/
+#define HELIOS_BVH_BINS 16
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Node of a Scene_BVH, 32 bytes so two siblings share a cache line
+ *
+ * Leaves have a non zero count and reference the objects [first, first+count) of the
+ * leaf order. Interior nodes have a count of 0 and their children are the nodes first
+ * and first+1.
+*/
+struct BVH_Node
+{
+    glm::vec3 bounds_min;   //!< Minimum corner of the box enclosing the node
+    uint first;             //!< First object of a leaf, first child of an interior node
+    glm::vec3 bounds_max;   //!< Maximum corner of the box enclosing the node
+    uint count;             //!< Number of objects of a leaf, 0 for interior nodes
+};
+
+/**
+ * @brief Box of an object of a Scene_BVH, stored in the order of the leaves so
+ * traversals read the objects of a leaf contiguously
+ *
+*/
+struct BVH_Object
+{
+    glm::vec3 bounds_min;   //!< Minimum corner of the world space box of the object
+    uint object;            //!< Identifier of the object
+    glm::vec3 bounds_max;   //!< Maximum corner of the world space box of the object
+    uint leaf;              //!< Leaf holding the object
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Bounding volume hierarchy over the world space boxes of scene objects
+ *
+ * Objects are identified by the index returned by insert(). Inserting objects requires
+ * a build(), moving them only requires a refit(), which walks up from the leaves of the
+ * moved objects. Refitting keeps the tree valid but not optimal, rebuild once objects
+ * have moved far from where they were at build time (e.g when getRefitGrowth() goes
+ * past 2).
+*/
+class Scene_BVH
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        std::vector<BVH_Node> nodes;        //!< The tree, the root is the first node
+        std::vector<uint> parents;          //!< Parent of every node
+        std::vector<BVH_Object> objects;    //!< Boxes of the objects in leaf order
+        std::vector<uint> slots;            //!< Position of every object in objects
+        std::vector<uint> moved;            //!< Objects updated since the last refit
+        float built_area;   //!< Surface area of all nodes when the tree was built
+        float area;         //!< Surface area of all nodes after the last refit
+        bool built;         //!< Whether the tree holds every inserted object
+
+        /**
+         * @brief Build the subtree of a node, spawning tasks for large subtrees
+         *
+         * @param node The node, its objects are [first, first+count) of the leaf order
+         * @param node_count Number of allocated nodes, shared by all tasks
+        */
+        void build_node(uint node, std::atomic<uint> &node_count);
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create an empty hierarchy
+         *
+        */
+        Scene_BVH();
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of objects inserted
+         *
+        */
+        uint inline getObjectCount(){return objects.size();}
+        /**
+         * @brief Get the number of nodes of the tree
+         *
+        */
+        uint inline getNodeCount(){return nodes.size();}
+        /**
+         * @brief Get the surface area of the tree relative to when it was built
+         *
+         * Culling and ray queries get slower as this grows.
+        */
+        float inline getRefitGrowth(){return built_area > 0? area/built_area : 1;}
+
+//──── Building ──────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Add an object to the scene, the tree must be built before querying it
+         *
+         * @param bounds_min Minimum corner of the world space box of the object
+         * @param bounds_max Maximum corner of the world space box of the object
+         * @return uint Identifier of the object, reported by the queries
+        */
+        uint insert(glm::vec3 bounds_min, glm::vec3 bounds_max);
+        /**
+         * @brief Add a placed mesh instance to the scene
+         *
+         * @param mesh The mesh, its object space box is used
+         * @param model Model matrix of the instance
+         * @return uint Identifier of the object, reported by the queries
+        */
+        uint insert(Mesh &mesh, const glm::mat4 &model);
+        /**
+         * @brief Move an object, the new box is used after the next refit()
+         *
+         * @param object Identifier returned by insert()
+         * @param bounds_min New minimum corner of the world space box of the object
+         * @param bounds_max New maximum corner of the world space box of the object
+        */
+        void update(uint object, glm::vec3 bounds_min, glm::vec3 bounds_max);
+        /**
+         * @brief Move a placed mesh instance, the new box is used after the next refit()
+         *
+         * @param object Identifier returned by insert()
+         * @param mesh The mesh of the instance
+         * @param model New model matrix of the instance
+        */
+        void update(uint object, Mesh &mesh, const glm::mat4 &model);
+        /**
+         * @brief Build the tree over every inserted object
+         *
+         * Splits are chosen with a binned surface area heuristic. Subtrees with many
+         * objects are built in parallel.
+        */
+        void build();
+        /**
+         * @brief Grow the boxes of the nodes above the objects moved by update()
+         *
+         * Builds the tree instead if objects were inserted since the last build.
+        */
+        void refit();
+        /**
+         * @brief Remove every object
+         *
+        */
+        void clear();
+
+//──── Queries ───────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Find the objects whose boxes intersect a frustum
+         *
+         * Subtrees fully outside a plane are skipped and subtrees fully inside the
+         * frustum are accepted without further tests.
+         *
+         * @param frustum The view volume, in world space
+         * @param visible Filled with the identifiers of the visible objects
+         * @return uint The number of visible objects
+        */
+        uint cull(const Frustum &frustum, std::vector<uint> &visible);
+        /**
+         * @brief Find the closest object hit by a ray
+         *
+         * Nodes are visited front to back, so subtrees behind the current closest hit are
+         * skipped.
+         *
+         * @param origin Origin of the ray
+         * @param direction Direction of the ray, need not be normalized
+         * @param distance Where to store the distance to the hit along the ray, in units
+         *        of direction
+         * @param hit_test Optional exact test of an object whose box the ray intersects,
+         *        it receives the object and the distance to its box and returns whether
+         *        the ray hits it, updating the distance (e.g against the triangles)
+         * @return int The identifier of the object hit, -1 if none is
+        */
+        int raycast(glm::vec3 origin, glm::vec3 direction, float &distance,
+            const std::function<bool(uint, float&)> &hit_test = nullptr);
+        /**
+         * @brief Find the object in front of a camera, for mouse picking
+         *
+         * @param camera The camera, the ray starts at its position along its forward
+         * @param distance Where to store the distance to the hit
+         * @return int The identifier of the object hit, -1 if none is
+        */
+        int inline pick(Camera &camera, float &distance)
+        {return raycast(camera.getPosition(), camera.getForward(), distance);}
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Compute the axis aligned box enclosing a transformed box
+ *
+ * @param model The transformation
+ * @param bounds_min Minimum corner of the box, replaced by the transformed one
+ * @param bounds_max Maximum corner of the box, replaced by the transformed one
+*/
+void transform_box(const glm::mat4 &model, glm::vec3 &bounds_min, glm::vec3 &bounds_max);
+
+}//Close Helios namespace
+//########################################################################################
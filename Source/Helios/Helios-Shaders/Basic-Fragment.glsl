@@ -18,9 +18,21 @@ out vec4 fragment_color;
 
 vec3 light = vec3(20,20,20);
 
-uniform vec3 camera_position;
+// Camera of the frame, written once per frame by Camera::load_to_buffer
+layout(std140, binding = 0) uniform Camera_Block
+{
+    mat4 view;
+    mat4 projection;
+    mat4 view_projection;
+    mat4 inverse_view;
+    mat4 inverse_projection;
+    mat4 inverse_view_projection;
+    vec4 position;  // xyz world space position
+    vec4 viewport;  // width, height, near plane, far plane
+} camera;
 
 uniform sampler2D testing;
+uniform vec3 material_diffuse = vec3(1); // set per material by Mesh::draw_materials
 
 vec4 blinn_phong()
 {
@@ -30,9 +42,9 @@ vec4 blinn_phong()
 	vec3 l = vec3(light-v_pos);
 	if(length(l)>0)
 		l = normalize(l);
-    vec3 c = vec3(texture(testing, v_uv));
+    vec3 c = vec3(texture(testing, v_uv))*material_diffuse;
 	vec3 n = normalize(v_norm);
-	vec3 e = camera_position-v_pos;
+	vec3 e = camera.position.xyz-v_pos;
 	e = normalize(e);
 	vec3 h = normalize(e+l);
 
@@ -19,16 +19,31 @@ out vec3 v_norm;
 out vec2 v_uv;
 
 uniform mat4 model_m = mat4(1); // model matrix
-uniform mat4 view_m = mat4(1);  // view matrix
-uniform mat4 proj_m = mat4(1);  // perspective projection matrix
+
+// Camera of the frame, written once per frame by Camera::load_to_buffer
+layout(std140, binding = 0) uniform Camera_Block
+{
+    mat4 view;
+    mat4 projection;
+    mat4 view_projection;
+    mat4 inverse_view;
+    mat4 inverse_projection;
+    mat4 inverse_view_projection;
+    vec4 position;  // xyz world space position
+    vec4 viewport;  // width, height, near plane, far plane
+} camera;
+
+uniform vec3 position_scale = vec3(1);  // dequantization scale of the positions
+uniform vec3 position_offset = vec3(0); // dequantization offset of the positions
 
 void main()
 {
-    vec4 pos = view_m*model_m*vec4(position, 1.0);
-    gl_Position = proj_m*pos;
+    vec3 object_position = position*position_scale + position_offset;
+    vec4 pos = model_m*vec4(object_position, 1.0);
+    gl_Position = camera.view_projection*pos;
 
-    v_pos = vec3(model_m*pos);
-    v_norm = vec3(model_m*vec4(normal,1.0));
+    v_pos = vec3(pos);
+    v_norm = mat3(model_m)*normal;
     v_uv = uv;
 
 }
\ No newline at end of file
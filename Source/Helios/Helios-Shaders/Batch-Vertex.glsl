@@ -0,0 +1,57 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Vertex shader for meshes drawn through a Draw_Batch
+ *
+ * @file Batch-Vertex.glsl
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#version 430
+#extension GL_ARB_shader_draw_parameters : require
+
+layout(location = 0) in vec3 position;  // (x,y,z) coordinates of a vertex
+layout(location = 1) in vec3 normal;    // normal to the vertex
+layout(location = 2) in vec2 uv;        // texture coordinates
+
+out vec3 v_pos;
+out vec3 v_norm;
+out vec2 v_uv;
+
+// Data of every draw of the batch, the base instance of a draw is its index
+struct Batch_Draw
+{
+    mat4 model;
+    vec4 position_scale;
+    vec4 position_offset;
+};
+layout(std430, binding = 0) readonly buffer Batch_Draws
+{
+    Batch_Draw draws[];
+};
+
+// Camera of the frame, written once per frame by Camera::load_to_buffer
+layout(std140, binding = 0) uniform Camera_Block
+{
+    mat4 view;
+    mat4 projection;
+    mat4 view_projection;
+    mat4 inverse_view;
+    mat4 inverse_projection;
+    mat4 inverse_view_projection;
+    vec4 position;  // xyz world space position
+    vec4 viewport;  // width, height, near plane, far plane
+} camera;
+
+void main()
+{
+    Batch_Draw draw = draws[gl_BaseInstanceARB];
+    vec3 object_position = position*draw.position_scale.xyz + draw.position_offset.xyz;
+    vec4 pos = draw.model*vec4(object_position, 1.0);
+    gl_Position = camera.view_projection*pos;
+
+    v_pos = vec3(pos);
+    v_norm = mat3(draw.model)*normal;
+    v_uv = uv;
+}
@@ -0,0 +1,59 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Compute shader building one level of a Depth_Pyramid
+ *
+ * @file Depth-Pyramid-Compute.glsl
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#version 430
+
+layout(local_size_x = 8, local_size_y = 8) in;
+
+uniform sampler2D depth;    // depth buffer, read by the first level
+uniform int level;          // level being written
+
+layout(r32f, binding = 0) uniform readonly image2D source;         // level below
+layout(r32f, binding = 1) uniform writeonly image2D destination;   // level written
+
+// Read a texel of the level below, clamped to its size
+float read(ivec2 texel, ivec2 size)
+{
+    return imageLoad(source, min(texel, size - 1)).r;
+}
+
+void main()
+{
+    ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 size = imageSize(destination);
+    if(any(greaterThanEqual(texel, size)))
+        return;
+    if(level == 0)
+    {
+        imageStore(destination, texel, vec4(texelFetch(depth, texel, 0).r));
+        return;
+    }
+
+    ivec2 source_size = imageSize(source);
+    ivec2 base = texel*2;
+    float farthest = max(
+        max(read(base, source_size), read(base + ivec2(1, 0), source_size)),
+        max(read(base + ivec2(0, 1), source_size), read(base + 1, source_size)));
+
+    // The last row and column of an odd sized level also cover the texels left over
+    bool extra_x = (source_size.x & 1) == 1 && texel.x == size.x - 1;
+    bool extra_y = (source_size.y & 1) == 1 && texel.y == size.y - 1;
+    if(extra_x)
+        farthest = max(farthest, max(read(base + ivec2(2, 0), source_size),
+            read(base + ivec2(2, 1), source_size)));
+    if(extra_y)
+        farthest = max(farthest, max(read(base + ivec2(0, 2), source_size),
+            read(base + ivec2(1, 2), source_size)));
+    if(extra_x && extra_y)
+        farthest = max(farthest, read(base + ivec2(2, 2), source_size));
+
+    imageStore(destination, texel, vec4(farthest));
+}
+//########################################################################################
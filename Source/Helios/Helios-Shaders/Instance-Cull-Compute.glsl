@@ -0,0 +1,126 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Compute shader writing the draw commands of the visible instances of a
+ * Culling_Pass
+ *
+ * @file Instance-Cull-Compute.glsl
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#version 430
+
+layout(local_size_x = 64) in;
+
+// Layout of a command read by glMultiDrawElementsIndirect
+struct Draw_Command
+{
+    uint count;
+    uint instance_count;
+    uint first_index;
+    int base_vertex;
+    uint base_instance;
+};
+// Instances sorted by group, see Cull_Instance
+struct Cull_Instance
+{
+    vec4 sphere;
+    Draw_Command command;
+    uint group;
+    uint output_first;
+    uint padding;
+};
+layout(std430, binding = 2) readonly buffer Cull_Instances
+{
+    Cull_Instance instances[];
+};
+layout(std430, binding = 3) writeonly buffer Draw_Commands
+{
+    Draw_Command commands[];
+};
+layout(std430, binding = 4) buffer Draw_Counts
+{
+    uint counts[];
+};
+
+uniform vec4 planes[6];         // world space frustum planes, normals point inside
+uniform int instance_count;     // number of instances to test
+uniform bool compact;           // append visible commands instead of keeping every slot
+
+uniform bool occlusion = false;     // whether to test against the depth pyramid
+uniform sampler2D depth_pyramid;    // farthest depth of the previous frame, per level
+uniform mat4 pyramid_view_projection;   // transform the pyramid was built with
+uniform int pyramid_levels;         // number of levels of the pyramid
+
+// Whether a sphere is hidden behind the depth of the previous frame
+bool occluded(vec4 sphere)
+{
+    // Window space box of the cube around the sphere
+    vec3 box_min = vec3(1e30), box_max = vec3(-1e30);
+    for(int corner=0; corner<8; corner++)
+    {
+        vec3 offset = vec3((corner & 1) == 0? -1 : 1, (corner & 2) == 0? -1 : 1,
+            (corner & 4) == 0? -1 : 1)*sphere.w;
+        vec4 clip = pyramid_view_projection*vec4(sphere.xyz + offset, 1);
+        // Spheres crossing the camera plane cannot be projected, keep them
+        if(clip.w <= 0)
+            return false;
+        vec3 window = clip.xyz/clip.w*0.5 + 0.5;
+        box_min = min(box_min, window);
+        box_max = max(box_max, window);
+    }
+    vec2 uv_min = clamp(box_min.xy, 0.0, 1.0), uv_max = clamp(box_max.xy, 0.0, 1.0);
+
+    // Pick the level at which the box covers at most 2x2 texels
+    vec2 extent = (uv_max - uv_min)*vec2(textureSize(depth_pyramid, 0));
+    int level = int(ceil(log2(max(max(extent.x, extent.y), 1.0))));
+    level = clamp(level, 0, pyramid_levels - 1);
+    ivec2 size = textureSize(depth_pyramid, level);
+    ivec2 low = ivec2(uv_min*size), high = min(ivec2(uv_max*size), size - 1);
+    if(any(greaterThan(high - low, ivec2(1))) && level < pyramid_levels - 1)
+    {
+        level++;
+        size = textureSize(depth_pyramid, level);
+        low = ivec2(uv_min*size);
+        high = min(ivec2(uv_max*size), size - 1);
+    }
+
+    float farthest = max(
+        max(texelFetch(depth_pyramid, low, level).r,
+            texelFetch(depth_pyramid, ivec2(high.x, low.y), level).r),
+        max(texelFetch(depth_pyramid, ivec2(low.x, high.y), level).r,
+            texelFetch(depth_pyramid, high, level).r));
+    return box_min.z > farthest;
+}
+
+void main()
+{
+    uint index = gl_GlobalInvocationID.x;
+    if(index >= uint(instance_count))
+        return;
+    Cull_Instance instance = instances[index];
+
+    bool visible = true;
+    vec4 sphere = instance.sphere;
+    for(int p=0; p<6 && visible; p++)
+        visible = dot(planes[p].xyz, sphere.xyz) + planes[p].w >= -sphere.w;
+    if(visible && occlusion)
+        visible = !occluded(sphere);
+
+    Draw_Command command = instance.command;
+    if(compact)
+    {
+        if(visible)
+        {
+            uint slot = atomicAdd(counts[instance.group], 1);
+            commands[instance.output_first + slot] = command;
+        }
+    }
+    else
+    {
+        command.instance_count = visible? 1 : 0;
+        commands[index] = command;
+    }
+}
+//########################################################################################
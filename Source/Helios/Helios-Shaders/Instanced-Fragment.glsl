@@ -0,0 +1,62 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Fragment shader for meshes drawn with Mesh::draw_instanced
+ * 
+ * @file Instanced-Fragment.glsl
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#version 430
+
+in vec3 v_pos;
+in vec3 v_norm;
+in vec2 v_uv;
+in vec4 v_color;
+
+out vec4 fragment_color;
+
+vec3 light = vec3(20,20,20);
+
+// Camera of the frame, written once per frame by Camera::load_to_buffer
+layout(std140, binding = 0) uniform Camera_Block
+{
+    mat4 view;
+    mat4 projection;
+    mat4 view_projection;
+    mat4 inverse_view;
+    mat4 inverse_projection;
+    mat4 inverse_view_projection;
+    vec4 position;  // xyz world space position
+    vec4 viewport;  // width, height, near plane, far plane
+} camera;
+
+uniform sampler2D testing;
+uniform vec3 material_diffuse = vec3(1); // set per material by Mesh::draw_materials
+
+vec4 blinn_phong()
+{
+    vec3 pos = v_pos;
+
+	vec4 color = vec4(0);
+	vec3 l = vec3(light-v_pos);
+	if(length(l)>0)
+		l = normalize(l);
+    vec3 c = vec3(texture(testing, v_uv))*material_diffuse;
+	vec3 n = normalize(v_norm);
+	vec3 e = camera.position.xyz-v_pos;
+	e = normalize(e);
+	vec3 h = normalize(e+l);
+
+	color = vec4(c*(vec3(0.5)+0.5*max(0,dot(n,l))) +
+		vec3(0.1)*max(0,pow(dot(h,n), 100)), 1);
+
+    return color;
+
+}
+
+void main()
+{
+    fragment_color = blinn_phong()*v_color;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Vertex shader for meshes drawn with Mesh::draw_instanced
+ *
+ * @file Instanced-Vertex.glsl
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#version 430
+#extension GL_ARB_shader_draw_parameters : require
+
+layout(location = 0) in vec3 position;  // (x,y,z) coordinates of a vertex
+layout(location = 1) in vec3 normal;    // normal to the vertex
+layout(location = 2) in vec2 uv;        // texture coordinates
+
+out vec3 v_pos;
+out vec3 v_norm;
+out vec2 v_uv;
+out vec4 v_color;
+
+// Data of every instance, see Mesh_Instance
+struct Mesh_Instance
+{
+    mat4 model;
+    vec4 color;
+};
+layout(std430, binding = 1) readonly buffer Mesh_Instances
+{
+    Mesh_Instance instances[];
+};
+
+// Camera of the frame, written once per frame by Camera::load_to_buffer
+layout(std140, binding = 0) uniform Camera_Block
+{
+    mat4 view;
+    mat4 projection;
+    mat4 view_projection;
+    mat4 inverse_view;
+    mat4 inverse_projection;
+    mat4 inverse_view_projection;
+    vec4 position;  // xyz world space position
+    vec4 viewport;  // width, height, near plane, far plane
+} camera;
+
+uniform vec3 position_scale = vec3(1);  // dequantization scale of the positions
+uniform vec3 position_offset = vec3(0); // dequantization offset of the positions
+
+void main()
+{
+    Mesh_Instance instance = instances[gl_BaseInstanceARB + gl_InstanceID];
+    vec3 object_position = position*position_scale + position_offset;
+    vec4 pos = instance.model*vec4(object_position, 1.0);
+    gl_Position = camera.view_projection*pos;
+
+    v_pos = vec3(pos);
+    v_norm = mat3(instance.model)*normal;
+    v_uv = uv;
+    v_color = instance.color;
+}
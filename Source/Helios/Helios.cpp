@@ -30,9 +30,10 @@ namespace Helios {
 bool HeliosInit()
 {
     //Enable debugging messages
-    glEnable(GL_DEBUG_OUTPUT);
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
+    GL_State &state = GL_State::current();
+    state.enable(GL_DEBUG_OUTPUT);
+    state.enable(GL_DEPTH_TEST);
+    state.depth_func(GL_LESS);
     glDebugMessageCallback((GLDEBUGPROC)Helios::errorCallback, NULL);
     /*glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE,
         GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, false);*/
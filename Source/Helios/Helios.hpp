@@ -18,7 +18,14 @@
 
 //Helios headers
 #include "Helios-Wrappers.hpp"
+#include "Draw-Batch.hpp"
+#include "GPU-Culling.hpp"
 #include "Camera.hpp"
+#include "Scene-BVH.hpp"
+#include "Profiling.hpp"
+#include "Streaming-Mesh.hpp"
+#include "Mesh-Loader.hpp"
+#include "Asset-Registry.hpp"
 namespace Helios{
 //########################################################################################
 
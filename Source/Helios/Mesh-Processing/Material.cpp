@@ -0,0 +1,221 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of wavefront materials (.mtl) and per material sub-meshes
+ *
+ * @file Material.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Material.hpp"
+
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Get the directory part of a path, including the final separator
+ *
+ * @param file_path Path to a file
+ * @return string The directory, empty if the path has none
+*/
+string inline static directory_of(const string &file_path)
+{
+    size_t separator = file_path.find_last_of('/');
+    return separator==string::npos? "" : file_path.substr(0, separator+1);
+}
+/**
+ * @brief Copy a string into a fixed size array, truncating it if needed
+ *
+ * @param destination The array
+ * @param size Size of the array in bytes
+ * @param source The string to copy
+*/
+void inline static copy_string(char *destination, size_t size, const string &source)
+{
+    size_t length = std::min(source.size(), size-1);
+    memcpy(destination, source.data(), length);
+    destination[length] = 0;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Create an untextured material
+Material default_material(string name)
+{
+    Material material = {};
+    material.diffuse = vec3(0.8f);
+    material.specular = vec3(0.5f);
+    material.shininess = 32.f;
+    material.opacity = 1.f;
+    copy_string(material.name, HELIOS_MATERIAL_NAME_SIZE, name);
+    return material;
+}
+
+//Parse a material library
+bool load_mtl(string file_path, vector<Material> &materials)
+{
+    ifstream file(file_path.c_str());
+    if(!file.is_open())
+    {
+        cerr << "Unable to open material library " << file_path << endl;
+        Log::record_log(
+            string(80, '!') +
+            "\nUnable to open material library: " + file_path + "\n" +
+            string(80, '!')
+            );
+        return false;
+    }
+
+    string directory = directory_of(file_path);
+    string line;
+    while(getline(file, line))
+    {
+        istringstream tokens(line);
+        string keyword;
+        if(!(tokens >> keyword) || keyword[0]=='#')
+            continue;
+
+        if(keyword == "newmtl")
+        {
+            string name;
+            getline(tokens >> ws, name);
+            materials.push_back(default_material(name));
+            continue;
+        }
+        //Statements before the first material have nothing to apply to
+        if(materials.empty())
+            continue;
+
+        Material &material = materials.back();
+        if(keyword == "Ka")
+            tokens >> material.ambient.x >> material.ambient.y >> material.ambient.z;
+        else if(keyword == "Kd")
+            tokens >> material.diffuse.x >> material.diffuse.y >> material.diffuse.z;
+        else if(keyword == "Ks")
+            tokens >> material.specular.x >> material.specular.y >> material.specular.z;
+        else if(keyword == "Ns")
+            tokens >> material.shininess;
+        else if(keyword == "d")
+            tokens >> material.opacity;
+        else if(keyword == "Tr")
+        {
+            float transparency = 0;
+            tokens >> transparency;
+            material.opacity = 1.f - transparency;
+        }
+        else if(keyword == "map_Kd")
+        {
+            //Options such as "-s 1 1 1" may precede the file name, which comes last
+            string texture;
+            while(tokens >> texture);
+            replace(texture.begin(), texture.end(), '\\', '/');
+            if(!texture.empty() && texture[0]!='/')
+                texture = directory + texture;
+            copy_string(material.diffuse_map, HELIOS_MATERIAL_PATH_SIZE, texture);
+        }
+    }
+    return true;
+}
+
+//Read every library of a wavefront file
+vector<Material> load_obj_materials(string obj_path, const Obj_Data &data)
+{
+    vector<Material> materials;
+    string directory = directory_of(obj_path);
+    for(const string &library : data.material_libraries)
+        load_mtl(directory + library, materials);
+    return materials;
+}
+
+//Sort the triangles of a file by material
+vector<Submesh> group_by_material(Obj_Data &data, vector<Material> &materials)
+{
+    //Material used by every "usemtl" name
+    vector<uint> name_material(data.material_names.size());
+    for(uint i=0; i<name_material.size(); i++)
+    {
+        const string &name = data.material_names[i];
+        uint m = 0;
+        while(m<materials.size() && name != materials[m].name)
+            m++;
+        if(m == materials.size())
+            materials.push_back(default_material(name));
+        name_material[i] = m;
+    }
+
+    //Material of every triangle, faces before the first "usemtl" get a new material
+    uint triangle_count = data.corners.size()/3;
+    uint no_material = materials.size();
+    vector<uint> triangle_material(triangle_count);
+    vector<uint> counts(no_material + 1, 0);
+    uint current = no_material;
+    size_t change = 0;
+    for(uint t=0; t<triangle_count; t++)
+    {
+        while(change<data.material_changes.size() &&
+            uint(data.material_changes[change].x) <= 3*t)
+            current = name_material[data.material_changes[change++].y];
+        triangle_material[t] = current;
+        counts[current]++;
+    }
+    if(counts[no_material] > 0)
+        materials.push_back(default_material("default"));
+    data.material_changes.clear();
+
+    //Used materials ordered by texture, the sort is stable to keep the file order
+    vector<uint> order;
+    for(uint m=0; m<materials.size(); m++)
+        if(counts[m] > 0)
+            order.push_back(m);
+    stable_sort(order.begin(), order.end(), [&materials](uint a, uint b)
+        {return strcmp(materials[a].diffuse_map, materials[b].diffuse_map) < 0;});
+
+    vector<Submesh> submeshes;
+    vector<uint> first_triangle(materials.size());
+    uint offset = 0;
+    for(uint m : order)
+    {
+        first_triangle[m] = offset;
+        submeshes.push_back({3*offset, 3*counts[m], m});
+        offset += counts[m];
+    }
+    if(submeshes.size() <= 1)
+        return submeshes;
+
+    //Counting sort of the triangles into their ranges
+    vector<ivec3> sorted(data.corners.size());
+    for(uint t=0; t<triangle_count; t++)
+    {
+        uint destination = first_triangle[triangle_material[t]]++;
+        for(uint i=0; i<3; i++)
+            sorted[3*destination + i] = data.corners[3*t + i];
+    }
+    data.corners.swap(sorted);
+    return submeshes;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,122 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of wavefront materials (.mtl) and per material sub-meshes
+ *
+ * @file Material.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Obj-Loader.hpp"
+
+#include <cstdint>
+//########################################################################################
+
+/**
+ * @brief Size in bytes of the name of a material, including the terminating 0
+ *
+*/
+#define HELIOS_MATERIAL_NAME_SIZE 64
+/**
+ * @brief Size in bytes of the texture paths of a material, including the terminating 0
+ *
+*/
+#define HELIOS_MATERIAL_PATH_SIZE 256
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Surface properties read from a wavefront material library
+ *
+ * The structure has a fixed size and no pointers so it can be stored in mesh caches
+ * as is. Names and paths longer than their arrays are truncated.
+*/
+struct Material
+{
+    glm::vec3 ambient;      //!< Ambient color ("Ka")
+    float shininess;        //!< Specular exponent ("Ns")
+    glm::vec3 diffuse;      //!< Diffuse color ("Kd")
+    float opacity;          //!< Opacity ("d", or 1 - "Tr")
+    glm::vec3 specular;     //!< Specular color ("Ks")
+    float padding;          //!< Unused
+    char name[HELIOS_MATERIAL_NAME_SIZE];           //!< Name given by "newmtl"
+    char diffuse_map[HELIOS_MATERIAL_PATH_SIZE];    //!< Texture of "map_Kd" or empty
+};
+
+/**
+ * @brief Range of the triangles of a mesh that share a material
+ *
+*/
+struct Submesh
+{
+    uint32_t first_index;   //!< Offset in indices of the range in the index buffer
+    uint32_t index_count;   //!< Number of indices of the range
+    uint32_t material;      //!< Index of the material of the range
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Create the material used by faces without one
+ *
+ * @param name Name of the material
+ * @return Material A light grey, untextured material
+*/
+Material default_material(std::string name);
+/**
+ * @brief Parse a wavefront material library
+ *
+ * Reads the "newmtl", "Ka", "Kd", "Ks", "Ns", "d", "Tr" and "map_Kd" statements, every
+ * other statement is ignored. Texture paths are made relative to the working directory.
+ *
+ * @param file_path Path to the .mtl file
+ * @param materials Array to which the materials of the library are appended
+ * @return true If the file could be read
+ * @return false If the file could not be opened
+*/
+bool load_mtl(std::string file_path, std::vector<Material> &materials);
+/**
+ * @brief Read the material libraries referenced by a parsed wavefront file
+ *
+ * Library paths are relative to the directory of the .obj file. Missing libraries are
+ * logged and skipped, their materials are replaced by default ones.
+ *
+ * @param obj_path Path of the .obj file
+ * @param data The parsed file
+ * @return std::vector<Material> The materials of every library
+*/
+std::vector<Material> load_obj_materials(std::string obj_path, const Obj_Data &data);
+/**
+ * @brief Make the triangles of every material contiguous
+ *
+ * Triangles are stably reordered so that each material forms a single range. Ranges
+ * are ordered by diffuse texture first, so drawing them in order binds every texture
+ * once. The "usemtl" names are looked up in the materials, unknown names and faces
+ * without a material get default materials appended to the array. The material
+ * changes of data are cleared since they no longer describe its corners.
+ *
+ * @param data The parsed file, its corners are reordered
+ * @param materials Materials of the file
+ * @return std::vector<Submesh> One range of corners per used material, in draw order
+*/
+std::vector<Submesh> group_by_material(Obj_Data &data, std::vector<Material> &materials);
+
+}//Close Helios namespace
+//########################################################################################
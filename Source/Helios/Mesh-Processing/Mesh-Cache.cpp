@@ -0,0 +1,372 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the binary mesh cache (.hmesh files)
+ *
+ * @file Mesh-Cache.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Mesh-Cache.hpp"
+#include "Helios-Wrappers.hpp"
+
+#include <cstring>
+#include <climits>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace std;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+
+//Alignment in bytes of every block inside a .hmesh file
+#define HMESH_ALIGNMENT 64
+
+//64 bit FNV constants
+#define FNV_OFFSET 1469598103934665603ull
+#define FNV_PRIME 1099511628211ull
+
+/**
+ * @brief Hash a range of bytes
+ *
+ * The bulk of the data is consumed 8 bytes at a time so hashing runs close to memory
+ * bandwidth, the tail is consumed byte by byte.
+ *
+ * @param data First byte of the range
+ * @param size Size in bytes of the range
+ * @return uint64_t The hash value
+*/
+uint64_t static hash_bytes(const char *data, size_t size)
+{
+    uint64_t hash = FNV_OFFSET;
+    size_t words = size/8;
+    for(size_t i=0; i<words; i++)
+    {
+        uint64_t word;
+        memcpy(&word, data + i*8, 8);
+        hash = (hash ^ word) * FNV_PRIME;
+        hash ^= hash >> 32;
+    }
+    for(size_t i=words*8; i<size; i++)
+        hash = (hash ^ uint8_t(data[i])) * FNV_PRIME;
+
+    return hash ^ size;
+}
+/**
+ * @brief Get the size and modification time of a file
+ *
+ * @param file_path Path to the file
+ * @param size Where to store the size in bytes
+ * @param mtime Where to store the modification time in nanoseconds
+ * @return true If the file exists
+*/
+bool static file_stats(string file_path, uint64_t &size, int64_t &mtime)
+{
+    struct stat info;
+    if(stat(file_path.c_str(), &info) != 0)
+        return false;
+
+    size = info.st_size;
+    mtime = int64_t(info.st_mtim.tv_sec)*1000000000 + info.st_mtim.tv_nsec;
+    return true;
+}
+//Round a byte offset up to the block alignment
+uint64_t inline static align_offset(uint64_t offset)
+{
+    return (offset + HMESH_ALIGNMENT - 1) / HMESH_ALIGNMENT * HMESH_ALIGNMENT;
+}
+/**
+ * @brief Whether every range of a list block lies inside the index buffer
+ *
+ * @param block First byte of the block, an array of Range
+ * @param size Size in bytes of the block
+ * @param index_count Number of indices of the mesh
+ * @return true If the block holds whole elements that only refer to existing indices
+*/
+template<typename Range>
+bool static ranges_inside(const char *block, uint64_t size, uint64_t index_count)
+{
+    if(size % sizeof(Range) != 0)
+        return false;
+    for(uint64_t i=0; i<size/sizeof(Range); i++)
+    {
+        Range range;
+        memcpy(&range, block + i*sizeof(Range), sizeof(Range));
+        if(uint64_t(range.first_index) + range.index_count > index_count)
+            return false;
+    }
+    return true;
+}
+/**
+ * @brief Check that the blocks of a cache match its header
+ *
+ * Every block the import flags require must be present once, vertex and index blocks
+ * must hold exactly the number of elements given by the header and list blocks may only
+ * refer to existing indices and materials.
+ *
+ * @param data First byte of the cache file, whose block ranges were already checked
+ * @param header Header of the cache
+ * @param entries Block table of the cache
+ * @return true If the blocks can be uploaded as they are
+*/
+bool static blocks_consistent(const char *data, const Helios::Mesh_Cache_Header &header,
+    const Helios::Mesh_Cache_Entry *entries)
+{
+    using namespace Helios;
+    bool quantized = header.import_flags & HELIOS_MESH_QUANTIZED;
+    uint64_t vertices = header.vertex_count;
+    uint64_t indices = header.index_count;
+
+    //Exact size of the blocks that are required
+    const uint block_types = MESH_BLOCK_MATERIALS + 1;
+    bool required[block_types] = {};
+    uint64_t expected[block_types] = {};
+    required[MESH_BLOCK_POSITIONS] = true;
+    expected[MESH_BLOCK_POSITIONS] = vertices*(quantized? 4*sizeof(GLushort) :
+        sizeof(glm::vec3));
+    if(header.import_flags & HELIOS_MESH_INTERLEAVED)
+    {
+        required[MESH_BLOCK_INTERLEAVED] = true;
+        expected[MESH_BLOCK_INTERLEAVED] = vertices*(quantized? sizeof(Quantized_Vertex) :
+            sizeof(Interleaved_Vertex));
+    }
+    else
+    {
+        required[MESH_BLOCK_NORMALS] = required[MESH_BLOCK_UVS] = true;
+        expected[MESH_BLOCK_NORMALS] = vertices*(quantized? sizeof(GLuint) :
+            sizeof(glm::vec3));
+        expected[MESH_BLOCK_UVS] = vertices*(quantized? 2*sizeof(GLhalf) :
+            sizeof(glm::vec2));
+    }
+    required[MESH_BLOCK_INDICES] = true;
+    expected[MESH_BLOCK_INDICES] = indices*(vertices <= 0xFFFF? sizeof(GLushort) :
+        sizeof(GLuint));
+    //List blocks are checked element by element
+    required[MESH_BLOCK_LODS] = true;
+    required[MESH_BLOCK_SUBMESHES] = true;
+    required[MESH_BLOCK_MATERIALS] = true;
+
+    bool found[block_types] = {};
+    uint64_t material_count = 0;
+    const char *submesh_block = nullptr;
+    uint64_t submesh_size = 0;
+    for(uint i=0; i<header.block_count; i++)
+    {
+        uint32_t type = entries[i].type;
+        const char *block = data + entries[i].offset;
+        uint64_t size = entries[i].size;
+        if(type >= block_types || found[type])
+            return false;
+        found[type] = true;
+
+        switch(type)
+        {
+            case MESH_BLOCK_LODS:
+                //The first level is the full mesh, it must exist
+                if(size < sizeof(Mesh_LOD) ||
+                    !ranges_inside<Mesh_LOD>(block, size, indices))
+                    return false;
+                break;
+            case MESH_BLOCK_MESHLETS:
+                if(!ranges_inside<Meshlet>(block, size, indices))
+                    return false;
+                break;
+            case MESH_BLOCK_SUBMESHES:
+                if(!ranges_inside<Submesh>(block, size, indices))
+                    return false;
+                submesh_block = block;
+                submesh_size = size;
+                break;
+            case MESH_BLOCK_MATERIALS:
+                if(size % sizeof(Material) != 0)
+                    return false;
+                material_count = size/sizeof(Material);
+                break;
+            default:
+                if(!required[type] || size != expected[type])
+                    return false;
+        }
+    }
+    for(uint type=0; type<block_types; type++)
+        if(required[type] && !found[type])
+            return false;
+
+    //Every range is drawn with a material of the mesh
+    for(uint64_t i=0; i<submesh_size/sizeof(Submesh); i++)
+    {
+        Submesh submesh;
+        memcpy(&submesh, submesh_block + i*sizeof(Submesh), sizeof(Submesh));
+        if(submesh.material >= material_count)
+            return false;
+    }
+    return true;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Mesh Cache Class                                   *
+ *                                                                                      */
+//========================================================================================
+
+//Map the cache of a source file and check whether it is still valid
+Mesh_Cache::Mesh_Cache(string source_path, uint32_t import_flags) :
+    file(cache_path(source_path, import_flags))
+{
+    header = nullptr;
+    entries = nullptr;
+    valid = false;
+
+    //Check the structure of the file
+    if(!file.is_open() || file.size() < sizeof(Mesh_Cache_Header))
+        return;
+
+    header = (const Mesh_Cache_Header*) file.data();
+    if(memcmp(header->magic, "HMSH", 4) != 0 || header->version != HMESH_VERSION ||
+        header->import_flags != import_flags)
+        return;
+
+    size_t table_end = sizeof(Mesh_Cache_Header) +
+        size_t(header->block_count)*sizeof(Mesh_Cache_Entry);
+    if(file.size() < table_end)
+        return;
+
+    entries = (const Mesh_Cache_Entry*)(file.data() + sizeof(Mesh_Cache_Header));
+    for(uint i=0; i<header->block_count; i++)
+        if(entries[i].offset > file.size() ||
+            entries[i].size > file.size() - entries[i].offset)
+            return;
+    if(!blocks_consistent(file.data(), *header, entries))
+        return;
+
+    //Check that the source has not changed since the cache was written
+    uint64_t size;
+    int64_t mtime;
+    if(!file_stats(source_path, size, mtime) || size != header->source_size)
+        return;
+    //A different time stamp alone (e.g the file was copied) does not invalidate the cache
+    uint64_t hash;
+    if(mtime != header->source_mtime &&
+        (!hash_file(source_path, hash) || hash != header->source_hash))
+        return;
+
+    valid = true;
+}
+
+//Get the blocks of the cache
+vector<Mesh_Block> Mesh_Cache::getBlocks()
+{
+    vector<Mesh_Block> blocks;
+    if(!valid)
+        return blocks;
+
+    for(uint i=0; i<header->block_count; i++)
+        blocks.push_back({entries[i].type, file.data() + entries[i].offset,
+            entries[i].size});
+
+    return blocks;
+}
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+//Derive the cache file name from the canonical path of the source
+string Mesh_Cache::cache_path(string source_path, uint32_t import_flags)
+{
+    char canonical[PATH_MAX];
+    string key = realpath(source_path.c_str(), canonical)? string(canonical) : source_path;
+
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx-%x", (unsigned long long)
+        hash_bytes(key.c_str(), key.size()), import_flags);
+    return string(HMESH_CACHE_DIRECTORY) + "/" + name + ".hmesh";
+}
+
+//Store the blocks of a mesh
+bool Mesh_Cache::write(string source_path, Mesh_Cache_Header header,
+    vector<Mesh_Block> &blocks)
+{
+    //Fill in the information identifying the source
+    memcpy(header.magic, "HMSH", 4);
+    header.version = HMESH_VERSION;
+    header.block_count = blocks.size();
+    if(!file_stats(source_path, header.source_size, header.source_mtime) ||
+        !hash_file(source_path, header.source_hash))
+        return false;
+
+    //Lay the blocks out after the block table
+    vector<Mesh_Cache_Entry> table(blocks.size());
+    uint64_t offset = sizeof(Mesh_Cache_Header) + blocks.size()*sizeof(Mesh_Cache_Entry);
+    for(uint i=0; i<blocks.size(); i++)
+    {
+        offset = align_offset(offset);
+        table[i] = {blocks[i].type, 0, offset, blocks[i].size};
+        offset += blocks[i].size;
+    }
+
+    //Write to a temporary file and rename it so readers never see a partial cache
+    string directory = HMESH_CACHE_DIRECTORY;
+    mkdir(directory.substr(0, directory.find_last_of('/')).c_str(), S_IRWXU);
+    mkdir(directory.c_str(), S_IRWXU);
+
+    string path = cache_path(source_path, header.import_flags);
+    string temporary = path + "." + to_string(getpid()) + ".tmp";
+    ofstream output(temporary, ios::binary | ios::trunc);
+    if(!output)
+        return false;
+
+    output.write((const char*)&header, sizeof(header));
+    output.write((const char*)table.data(), table.size()*sizeof(Mesh_Cache_Entry));
+    char padding[HMESH_ALIGNMENT] = {};
+    uint64_t position = sizeof(Mesh_Cache_Header) + table.size()*sizeof(Mesh_Cache_Entry);
+    for(uint i=0; i<blocks.size(); i++)
+    {
+        output.write(padding, table[i].offset - position);
+        output.write((const char*)blocks[i].data, blocks[i].size);
+        position = table[i].offset + blocks[i].size;
+    }
+    output.close();
+
+    if(!output || rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+        Log::record_log("Could not write mesh cache " + path + " for " + source_path);
+        return false;
+    }
+    return true;
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Hash the contents of a file
+bool hash_file(string file_path, uint64_t &hash)
+{
+    Helpers::Mapped_File file(file_path);
+    if(!file.is_open())
+        return false;
+
+    hash = hash_bytes(file.data(), file.size());
+    return true;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
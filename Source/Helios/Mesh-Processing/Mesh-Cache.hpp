@@ -0,0 +1,196 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the binary mesh cache (.hmesh files)
+ *
+ * @file Mesh-Cache.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "mapped_file.hpp"
+
+#include <cstdint>
+//########################################################################################
+
+/**
+ * @brief Version of the .hmesh format, caches with any other version are ignored
+ *
+*/
+#define HMESH_VERSION 4
+/**
+ * @brief Directory in which cached meshes are stored
+ *
+*/
+#define HMESH_CACHE_DIRECTORY "cache/meshes"
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+
+/**
+ * @brief Kind of data stored in a mesh block
+ *
+*/
+enum Mesh_Block_Type {MESH_BLOCK_POSITIONS=0, MESH_BLOCK_NORMALS, MESH_BLOCK_UVS,
+    MESH_BLOCK_INDICES, MESH_BLOCK_INTERLEAVED, MESH_BLOCK_LODS, MESH_BLOCK_MESHLETS,
+    MESH_BLOCK_SUBMESHES, MESH_BLOCK_MATERIALS};
+
+/**
+ * @brief A contiguous range of ready to upload mesh data
+ *
+ * Blocks only point to their data, the memory belongs to whoever created the block.
+*/
+struct Mesh_Block
+{
+    uint32_t type;      //!< What the block contains (a Mesh_Block_Type)
+    const void *data;   //!< First byte of the block
+    uint64_t size;      //!< Size in bytes of the block
+};
+
+/**
+ * @brief Header at the start of every .hmesh file
+ *
+ * The header is followed by a table of block_count Mesh_Cache_Entry and then by the
+ * data of every block, each one aligned to HMESH_ALIGNMENT bytes.
+*/
+struct Mesh_Cache_Header
+{
+    char magic[4];          //!< Always "HMSH"
+    uint32_t version;       //!< HMESH_VERSION at the time of writing
+    uint64_t source_size;   //!< Size in bytes of the source file
+    int64_t source_mtime;   //!< Modification time of the source file in nanoseconds
+    uint64_t source_hash;   //!< Hash of the contents of the source file
+    uint32_t import_flags;  //!< Options with which the source was imported
+    uint32_t block_count;   //!< Number of blocks in the file
+    uint32_t vertex_count;  //!< Number of vertices of the mesh
+    uint32_t index_count;   //!< Number of indices of the mesh
+    float bounds_min[3];    //!< Minimum corner of the axis aligned bounding box
+    float bounds_max[3];    //!< Maximum corner of the axis aligned bounding box
+    float bounding_sphere[4];   //!< Center and radius of the bounding sphere
+};
+
+/**
+ * @brief Location of a block inside a .hmesh file
+ *
+*/
+struct Mesh_Cache_Entry
+{
+    uint32_t type;      //!< What the block contains (a Mesh_Block_Type)
+    uint32_t padding;   //!< Unused, keeps the offsets 8 byte aligned
+    uint64_t offset;    //!< Offset in bytes from the start of the file
+    uint64_t size;      //!< Size in bytes of the block
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Memory mapped view of the cached binary version of a mesh source file
+ *
+ * Caches are stored in HMESH_CACHE_DIRECTORY under a name derived from the canonical
+ * path of the source and the import flags, so every import variant has its own cache.
+ * A cache is valid if its version and import options match and the source still has
+ * the recorded size and modification time, or, if only the modification time changed,
+ * the same content hash.
+*/
+class Mesh_Cache
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        Helpers::Mapped_File file;          //!< The mapped .hmesh file
+        const Mesh_Cache_Header *header;    //!< Header at the start of the file
+        const Mesh_Cache_Entry *entries;    //!< Block table following the header
+        bool valid;                         //!< Whether the cache can be used
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Open the cache associated to a source file
+         *
+         * @param source_path Path to the original mesh file (e.g a .obj file)
+         * @param import_flags Options the mesh is going to be imported with
+        */
+        Mesh_Cache(std::string source_path, uint32_t import_flags);
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Whether the cache exists and is up to date with its source
+         *
+        */
+        bool inline is_valid(){return valid;}
+        /**
+         * @brief Get the header of the cache, only meaningful if the cache is valid
+         *
+        */
+        const Mesh_Cache_Header inline &getHeader(){return *header;}
+        /**
+         * @brief Get every block in the cache, pointing into the mapped file
+         *
+         * @return std::vector<Mesh_Block> The blocks, empty if the cache is not valid
+        */
+        std::vector<Mesh_Block> getBlocks();
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the path of the cache file associated to a source file
+         *
+         * @param source_path Path to the original mesh file
+         * @param import_flags Options the mesh is imported with
+         * @return std::string Path of the .hmesh file
+        */
+        static std::string cache_path(std::string source_path, uint32_t import_flags);
+        /**
+         * @brief Write the cache of a source file
+         *
+         * The magic, version, block count and source information of the header are
+         * filled by this function, everything else (including the import flags) is
+         * written as given.
+         *
+         * @param source_path Path to the original mesh file
+         * @param header Header describing the mesh
+         * @param blocks Data blocks to store
+         * @return true If the cache was written
+         * @return false If the source or the cache file could not be accessed
+        */
+        static bool write(std::string source_path, Mesh_Cache_Header header,
+            std::vector<Mesh_Block> &blocks);
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Hash the contents of a file
+ *
+ * @param file_path Path to the file
+ * @param hash Where to store the hash value
+ * @return true If the file could be read
+ * @return false If the file could not be opened
+*/
+bool hash_file(std::string file_path, uint64_t &hash);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,344 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the mesh optimization passes run at import time
+ *
+ * @file Mesh-Optimizer.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Mesh-Optimizer.hpp"
+
+#include <cstring>
+#include <cstdint>
+#include <unordered_map>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Count the cache misses of a range of triangles starting from an empty cache
+ *
+ * @param indices Triangle list
+ * @param first First triangle of the range
+ * @param last One past the last triangle of the range
+ * @param cache_size Number of entries of the simulated FIFO cache
+ * @param timestamps Scratch array with one entry per vertex, must be zero filled before
+ *        the first call, time is the running clock shared by every call
+ * @param time Running clock, every call advances it past any stale timestamp
+ * @return uint Number of cache misses
+*/
+uint static count_misses(const vector<uint> &indices, uint first, uint last,
+    uint cache_size, vector<uint> &timestamps, uint &time)
+{
+    //A vertex is in the FIFO if fewer than cache_size misses happened since its own miss
+    time += cache_size + 1;
+    uint misses = 0;
+    for(uint i=first*3; i<last*3; i++)
+    {
+        uint v = indices[i];
+        if(time - timestamps[v] > cache_size)
+        {
+            timestamps[v] = time++;
+            misses++;
+        }
+    }
+    return misses;
+}
+/**
+ * @brief Build the vertex to triangle adjacency in compressed (CSR) form
+ *
+ * @param indices Triangle list
+ * @param vertex_count Number of vertices
+ * @param offsets Filled with the start of every vertex's list (vertex_count+1 entries)
+ * @param triangles Filled with the triangles of every vertex
+*/
+void static build_adjacency(const vector<uint> &indices, size_t vertex_count,
+    vector<uint> &offsets, vector<uint> &triangles)
+{
+    offsets.assign(vertex_count+1, 0);
+    for(uint v : indices)
+        offsets[v+1]++;
+    for(uint v=0; v<vertex_count; v++)
+        offsets[v+1] += offsets[v];
+
+    triangles.resize(indices.size());
+    vector<uint> fill(offsets.begin(), offsets.end()-1);
+    for(uint i=0; i<indices.size(); i++)
+        triangles[fill[indices[i]]++] = i/3;
+}
+/**
+ * @brief Hash of the bit pattern of a position
+ *
+ * Keys are compared with ==, for which -0 and 0 are equal, so both hash like 0.
+*/
+struct Position_Hash
+{
+    size_t operator()(const vec3 &p) const
+    {
+        vec3 canonical = p;
+        for(int axis=0; axis<3; axis++)
+            if(canonical[axis] == 0.0f)
+                canonical[axis] = 0.0f;
+        uint32_t bits[3];
+        memcpy(bits, &canonical, sizeof(bits));
+        uint64_t h = bits[0]*0x9E3779B97F4A7C15ull ^ bits[1]*0xC2B2AE3D27D4EB4Full ^
+            bits[2]*0x165667B19E3779F9ull;
+        return h ^ (h>>29);
+    }
+};
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Measure ACMR and ATVR
+Vertex_Cache_Stats analyze_vertex_cache(const vector<uint> &indices, size_t vertex_count,
+    uint cache_size)
+{
+    vector<uint> timestamps(vertex_count, 0);
+    uint time = 0;
+    uint misses = count_misses(indices, 0, indices.size()/3, cache_size, timestamps, time);
+
+    Vertex_Cache_Stats stats;
+    stats.acmr = indices.empty()? 0 : float(misses)/(indices.size()/3);
+    stats.atvr = vertex_count==0? 0 : float(misses)/vertex_count;
+    return stats;
+}
+
+//Tipsify
+void optimize_vertex_cache(vector<uint> &indices, size_t vertex_count,
+    vector<uint> &clusters, uint cache_size)
+{
+    clusters.clear();
+    uint triangle_count = indices.size()/3;
+    if(triangle_count == 0)
+        return;
+
+    vector<uint> offsets, adjacency;
+    build_adjacency(indices, vertex_count, offsets, adjacency);
+
+    //Live triangle count of every vertex
+    vector<uint> live(vertex_count);
+    for(uint v=0; v<vertex_count; v++)
+        live[v] = offsets[v+1] - offsets[v];
+
+    vector<uint> timestamps(vertex_count, 0);
+    vector<bool> emitted(triangle_count, false);
+    vector<uint> dead_end;
+    vector<uint> candidates;
+    vector<uint> output;
+    output.reserve(indices.size());
+
+    uint time = cache_size + 1;
+    uint cursor = 0;
+    int fanning = 0;
+    clusters.push_back(0);
+    while(fanning >= 0)
+    {
+        //Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        for(uint a=offsets[fanning]; a<offsets[fanning+1]; a++)
+        {
+            uint t = adjacency[a];
+            if(emitted[t])
+                continue;
+
+            for(int c=0; c<3; c++)
+            {
+                uint v = indices[3*t + c];
+                output.push_back(v);
+                dead_end.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                if(time - timestamps[v] > cache_size)
+                    timestamps[v] = time++;
+            }
+            emitted[t] = true;
+        }
+
+        //Pick the candidate that will still be in the cache with the most work left
+        int next = -1;
+        int best = -1;
+        for(uint v : candidates)
+        {
+            if(live[v] == 0)
+                continue;
+            int priority = 0;
+            if(time - timestamps[v] + 2*live[v] <= cache_size)
+                priority = time - timestamps[v];
+            if(priority > best)
+            {
+                best = priority;
+                next = v;
+            }
+        }
+        //Dead end, fall back to recently used vertices and then to a linear scan
+        if(next == -1)
+        {
+            while(!dead_end.empty() && next == -1)
+            {
+                uint v = dead_end.back();
+                dead_end.pop_back();
+                if(live[v] > 0)
+                    next = v;
+            }
+            while(next == -1 && cursor < vertex_count)
+            {
+                if(live[cursor] > 0)
+                    next = cursor;
+                cursor++;
+            }
+            //Jumping away from the current region starts a new cluster
+            if(next != -1 && output.size()/3 != clusters.back())
+                clusters.push_back(output.size()/3);
+        }
+        fanning = next;
+    }
+
+    indices.swap(output);
+}
+
+//Sort clusters to draw outward facing regions first
+void optimize_overdraw(vector<uint> &indices, const vector<vec3> &positions,
+    const vector<uint> &clusters, float threshold)
+{
+    uint triangle_count = indices.size()/3;
+    if(triangle_count == 0)
+        return;
+
+    //Split the clusters at every point where restarting from an empty cache costs less
+    //than the threshold compared to the cache efficiency of the whole cluster
+    vector<uint> timestamps(positions.size(), 0);
+    uint time = 0;
+    vector<uint> boundaries;
+    for(uint c=0; c<clusters.size(); c++)
+    {
+        uint first = clusters[c];
+        uint last = c+1<clusters.size()? clusters[c+1] : triangle_count;
+        float cluster_acmr = float(count_misses(indices, first, last,
+            HELIOS_VERTEX_CACHE_SIZE, timestamps, time)) / (last-first);
+
+        boundaries.push_back(first);
+        uint start = first;
+        time += HELIOS_VERTEX_CACHE_SIZE + 1;
+        uint misses = 0;
+        for(uint t=first; t<last; t++)
+        {
+            for(int k=0; k<3; k++)
+            {
+                uint v = indices[3*t + k];
+                if(time - timestamps[v] > HELIOS_VERTEX_CACHE_SIZE)
+                {
+                    timestamps[v] = time++;
+                    misses++;
+                }
+            }
+            if(t+1 < last && float(misses)/(t+1-start) <= cluster_acmr*threshold)
+            {
+                boundaries.push_back(t+1);
+                start = t+1;
+                misses = 0;
+                time += HELIOS_VERTEX_CACHE_SIZE + 1;
+            }
+        }
+    }
+
+    //Centroid of the whole mesh
+    vec3 mesh_centroid = vec3(0);
+    for(uint i=0; i<indices.size(); i++)
+        mesh_centroid += positions[indices[i]];
+    mesh_centroid /= float(indices.size());
+
+    //Sort key of every cluster, how far its centroid lies along its average normal
+    vector<float> keys(boundaries.size());
+    for(uint c=0; c<boundaries.size(); c++)
+    {
+        uint first = boundaries[c];
+        uint last = c+1<boundaries.size()? boundaries[c+1] : triangle_count;
+        vec3 centroid = vec3(0);
+        vec3 normal = vec3(0);
+        float area = 0;
+        for(uint t=first; t<last; t++)
+        {
+            vec3 a = positions[indices[3*t]];
+            vec3 b = positions[indices[3*t+1]];
+            vec3 d = positions[indices[3*t+2]];
+            //The cross product is the area weighted normal
+            vec3 n = cross(b-a, d-a);
+            float triangle_area = length(n);
+            centroid += (a+b+d)*(triangle_area/3.f);
+            normal += n;
+            area += triangle_area;
+        }
+        centroid = area>0? centroid/area : positions[indices[3*first]];
+        float normal_length = length(normal);
+        keys[c] = normal_length>0? dot(centroid - mesh_centroid, normal/normal_length) : 0;
+    }
+
+    vector<uint> order(boundaries.size());
+    for(uint c=0; c<order.size(); c++)
+        order[c] = c;
+    stable_sort(order.begin(), order.end(),
+        [&keys](uint a, uint b){return keys[a] > keys[b];});
+
+    vector<uint> output;
+    output.reserve(indices.size());
+    for(uint c : order)
+    {
+        uint first = boundaries[c];
+        uint last = c+1<boundaries.size()? boundaries[c+1] : triangle_count;
+        output.insert(output.end(), indices.begin()+3*first, indices.begin()+3*last);
+    }
+    indices.swap(output);
+}
+
+//Weld vertices by position
+uint weld_positions(const vector<vec3> &positions, vector<uint> &welded)
+{
+    unordered_map<vec3, uint, Position_Hash> ids;
+    ids.reserve(positions.size());
+    welded.resize(positions.size());
+    for(uint v=0; v<positions.size(); v++)
+        welded[v] = ids.insert({positions[v], uint(ids.size())}).first->second;
+    return ids.size();
+}
+//Store vertices in order of first use
+vector<uint> optimize_vertex_fetch(vector<uint> &indices, size_t vertex_count)
+{
+    const uint unused = 0xFFFFFFFFu;
+    vector<uint> remap(vertex_count, unused);
+    vector<uint> order;
+    order.reserve(vertex_count);
+    for(uint &index : indices)
+    {
+        if(remap[index] == unused)
+        {
+            remap[index] = order.size();
+            order.push_back(index);
+        }
+        index = remap[index];
+    }
+    return order;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,131 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the mesh optimization passes run at import time
+ *
+ * @file Mesh-Optimizer.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+//########################################################################################
+
+/**
+ * @brief Number of entries of the post transform vertex cache the passes optimize for
+ *
+*/
+#define HELIOS_VERTEX_CACHE_SIZE 16
+/**
+ * @brief Maximum ACMR degradation accepted by the overdraw pass (1.05 means 5%)
+ *
+*/
+#define HELIOS_OVERDRAW_THRESHOLD 1.05f
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Post transform vertex cache efficiency of an index buffer
+ *
+*/
+struct Vertex_Cache_Stats
+{
+    float acmr; //!< Average cache miss ratio, vertices transformed per triangle
+    float atvr; //!< Average transform to vertex ratio, 1 is optimal
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Simulate a FIFO vertex cache to measure the efficiency of an index buffer
+ *
+ * @param indices Triangle list
+ * @param vertex_count Number of vertices referenced by the indices
+ * @param cache_size Number of entries of the simulated cache
+ * @return Vertex_Cache_Stats The ACMR and ATVR of the index buffer
+*/
+Vertex_Cache_Stats analyze_vertex_cache(const std::vector<uint> &indices,
+    size_t vertex_count, uint cache_size = HELIOS_VERTEX_CACHE_SIZE);
+/**
+ * @brief Reorder triangles for post transform vertex cache locality (Tipsify)
+ *
+ * Implements "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw"
+ * (Sander, Nehab and Barczak 2007). The triangles are also split into clusters at every
+ * point where the algorithm had to jump to a new region of the mesh.
+ *
+ * @param indices Triangle list, reordered in place
+ * @param vertex_count Number of vertices referenced by the indices
+ * @param clusters Filled with the index of the first triangle of every cluster
+ * @param cache_size Number of entries of the targeted cache
+*/
+void optimize_vertex_cache(std::vector<uint> &indices, size_t vertex_count,
+    std::vector<uint> &clusters, uint cache_size = HELIOS_VERTEX_CACHE_SIZE);
+/**
+ * @brief Reorder the clusters of a vertex cache optimized mesh to reduce overdraw
+ *
+ * Clusters are first split further wherever that costs less than the threshold in
+ * cache efficiency, then sorted so the ones facing away from the center of the mesh,
+ * which are the most likely to occlude the rest, are drawn first.
+ *
+ * @param indices Triangle list ordered by optimize_vertex_cache(), reordered in place
+ * @param positions Vertex positions
+ * @param clusters Clusters found by optimize_vertex_cache()
+ * @param threshold Maximum accepted ACMR degradation inside a cluster
+*/
+void optimize_overdraw(std::vector<uint> &indices, const std::vector<glm::vec3> &positions,
+    const std::vector<uint> &clusters, float threshold = HELIOS_OVERDRAW_THRESHOLD);
+/**
+ * @brief Compute a vertex order in which vertices are stored in order of first use
+ *
+ * The indices are rewritten to the new order. Vertices that are never referenced are
+ * dropped.
+ *
+ * @param indices Triangle list, remapped in place
+ * @param vertex_count Number of vertices referenced by the indices
+ * @return std::vector<uint> For every new vertex, the old vertex it comes from
+*/
+std::vector<uint> optimize_vertex_fetch(std::vector<uint> &indices, size_t vertex_count);
+/**
+ * @brief Give the same id to every vertex with exactly the same position
+ *
+ * Vertices that only differ in their other attributes (e.g hard edges or texture seams)
+ * are separate vertices of the index buffer but the same point of the surface.
+ *
+ * @param positions Vertex positions
+ * @param welded Filled with the id of the position of every vertex
+ * @return uint Number of distinct positions
+*/
+uint weld_positions(const std::vector<glm::vec3> &positions, std::vector<uint> &welded);
+/**
+ * @brief Reorder an attribute array following the output of optimize_vertex_fetch()
+ *
+ * @tparam T Type of the attribute
+ * @param attribute The array to reorder
+ * @param order The old index of every new vertex
+*/
+template <class T>
+void inline remap_attribute(std::vector<T> &attribute, const std::vector<uint> &order)
+{
+    std::vector<T> remapped(order.size());
+    for(uint i=0; i<order.size(); i++)
+        remapped[i] = attribute[order[i]];
+    attribute.swap(remapped);
+}
+
+}//Close Helios namespace
+//########################################################################################
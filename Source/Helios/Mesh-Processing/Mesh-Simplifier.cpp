@@ -0,0 +1,415 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of quadric error metric mesh simplification
+ *
+ * @file Mesh-Simplifier.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Mesh-Simplifier.hpp"
+#include "Mesh-Optimizer.hpp"
+
+#include <cstdint>
+#include <cfloat>
+#include <queue>
+#include <unordered_map>
+#include <omp.h>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+/**
+ * @brief Weight of the planes that keep open borders in place, relative to face planes
+ *
+*/
+#define BORDER_WEIGHT 10.0
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Sum of weighted squared distances to a set of planes
+ *
+ * Stores the upper triangle of the symmetric 4x4 matrix of Garland and Heckbert, plus the
+ * total weight so the error can be reported as an average squared distance.
+*/
+struct Quadric
+{
+    double a00, a01, a02, a03, a11, a12, a13, a22, a23, a33;
+    double weight;
+};
+/**
+ * @brief Add a weighted plane n.p + d = 0 to a quadric
+ *
+ * @param q Quadric to which to add the plane
+ * @param n Unit normal of the plane
+ * @param d Offset of the plane
+ * @param w Weight of the plane
+*/
+void static add_plane(Quadric &q, dvec3 n, double d, double w)
+{
+    q.a00 += w*n.x*n.x; q.a01 += w*n.x*n.y; q.a02 += w*n.x*n.z; q.a03 += w*n.x*d;
+    q.a11 += w*n.y*n.y; q.a12 += w*n.y*n.z; q.a13 += w*n.y*d;
+    q.a22 += w*n.z*n.z; q.a23 += w*n.z*d;
+    q.a33 += w*d*d;
+    q.weight += w;
+}
+/**
+ * @brief Accumulate a quadric into another
+ *
+*/
+void static add_quadric(Quadric &q, const Quadric &r)
+{
+    q.a00 += r.a00; q.a01 += r.a01; q.a02 += r.a02; q.a03 += r.a03;
+    q.a11 += r.a11; q.a12 += r.a12; q.a13 += r.a13;
+    q.a22 += r.a22; q.a23 += r.a23;
+    q.a33 += r.a33;
+    q.weight += r.weight;
+}
+/**
+ * @brief Average squared distance from a point to the planes of two quadrics
+ *
+*/
+double static evaluate(const Quadric &q, const Quadric &r, vec3 point)
+{
+    double x = point.x, y = point.y, z = point.z;
+    double error =
+        (q.a00+r.a00)*x*x + 2*(q.a01+r.a01)*x*y + 2*(q.a02+r.a02)*x*z + 2*(q.a03+r.a03)*x +
+        (q.a11+r.a11)*y*y + 2*(q.a12+r.a12)*y*z + 2*(q.a13+r.a13)*y +
+        (q.a22+r.a22)*z*z + 2*(q.a23+r.a23)*z +
+        (q.a33+r.a33);
+    double weight = q.weight + r.weight;
+    return weight>0? fabs(error)/weight : 0;
+}
+/**
+ * @brief Candidate collapse of an edge onto one of its endpoints
+ *
+ * The versions of both vertices at the time the candidate was evaluated are kept, any
+ * change to either vertex makes the candidate stale.
+*/
+struct Collapse
+{
+    double cost;
+    uint from, to;
+    uint from_version, to_version;
+
+    bool operator>(const Collapse &other) const {return cost > other.cost;}
+};
+/**
+ * @brief Undirected edge key
+ *
+*/
+uint64_t inline static edge_key(uint a, uint b)
+{
+    return a<b? (uint64_t(a)<<32) | b : (uint64_t(b)<<32) | a;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Quadric error metric simplification
+vector<uint> simplify_mesh(const vector<vec3> &positions, const vector<vec3> &normals,
+    const vector<uint> &indices, size_t target_index_count, float max_error,
+    float &result_error)
+{
+    result_error = 0;
+
+    //Weld vertices sharing a position, the simplification works on the welded mesh
+    vector<uint> welded;
+    uint point_count = weld_positions(positions, welded);
+    vector<vec3> points(point_count);
+    for(uint v=0; v<positions.size(); v++)
+        points[welded[v]] = positions[v];
+
+    //Vertices of the original mesh at every welded point (CSR)
+    vector<uint> wedge_offsets(point_count+1, 0);
+    for(uint v=0; v<welded.size(); v++)
+        wedge_offsets[welded[v]+1]++;
+    for(uint p=0; p<point_count; p++)
+        wedge_offsets[p+1] += wedge_offsets[p];
+    vector<uint> wedges(welded.size());
+    vector<uint> fill(wedge_offsets.begin(), wedge_offsets.end()-1);
+    for(uint v=0; v<welded.size(); v++)
+        wedges[fill[welded[v]]++] = v;
+
+    //Welded triangles, their adjacency and the plane quadrics of every point
+    uint triangle_count = indices.size()/3;
+    vector<uint> triangles(3*triangle_count);
+    vector<bool> dead_triangle(triangle_count, false);
+    vector<vector<uint>> point_triangles(point_count);
+    vector<Quadric> quadrics(point_count, Quadric{});
+    uint live_triangles = 0;
+    for(uint t=0; t<triangle_count; t++)
+    {
+        uint a = welded[indices[3*t]], b = welded[indices[3*t+1]], c = welded[indices[3*t+2]];
+        triangles[3*t] = a; triangles[3*t+1] = b; triangles[3*t+2] = c;
+        if(a==b || b==c || c==a)
+        {
+            dead_triangle[t] = true;
+            continue;
+        }
+        live_triangles++;
+        point_triangles[a].push_back(t);
+        point_triangles[b].push_back(t);
+        point_triangles[c].push_back(t);
+
+        dvec3 n = cross(dvec3(points[b]-points[a]), dvec3(points[c]-points[a]));
+        double area = length(n);
+        if(area == 0)
+            continue;
+        n /= area;
+        double d = -dot(n, dvec3(points[a]));
+        add_plane(quadrics[a], n, d, area);
+        add_plane(quadrics[b], n, d, area);
+        add_plane(quadrics[c], n, d, area);
+    }
+
+    //Edges used by a single triangle are open borders, keep them in place
+    unordered_map<uint64_t, uint> edges;
+    for(uint t=0; t<triangle_count; t++)
+    {
+        if(dead_triangle[t])
+            continue;
+        for(int k=0; k<3; k++)
+            edges[edge_key(triangles[3*t+k], triangles[3*t+(k+1)%3])]++;
+    }
+    for(uint t=0; t<triangle_count; t++)
+    {
+        if(dead_triangle[t])
+            continue;
+        dvec3 a = dvec3(points[triangles[3*t]]);
+        dvec3 face_normal = cross(dvec3(points[triangles[3*t+1]])-a,
+            dvec3(points[triangles[3*t+2]])-a);
+        for(int k=0; k<3; k++)
+        {
+            uint p = triangles[3*t+k], q = triangles[3*t+(k+1)%3];
+            if(edges[edge_key(p,q)] != 1)
+                continue;
+            dvec3 edge = dvec3(points[q]) - dvec3(points[p]);
+            dvec3 n = cross(edge, face_normal);
+            double n_length = length(n);
+            if(n_length == 0)
+                continue;
+            n /= n_length;
+            double d = -dot(n, dvec3(points[p]));
+            double w = dot(edge, edge)*BORDER_WEIGHT;
+            add_plane(quadrics[p], n, d, w);
+            add_plane(quadrics[q], n, d, w);
+        }
+    }
+
+    //Queue every edge collapse in both directions, cheapest first
+    vector<uint> version(point_count, 0);
+    vector<bool> dead_point(point_count, false);
+    priority_queue<Collapse, vector<Collapse>, greater<Collapse>> queue;
+    auto push_edge = [&](uint a, uint b)
+    {
+        double cost_ab = evaluate(quadrics[a], quadrics[b], points[b]);
+        double cost_ba = evaluate(quadrics[a], quadrics[b], points[a]);
+        queue.push({cost_ab, a, b, version[a], version[b]});
+        queue.push({cost_ba, b, a, version[b], version[a]});
+    };
+    for(auto &edge : edges)
+        push_edge(uint(edge.first>>32), uint(edge.first & 0xFFFFFFFFu));
+    edges.clear();
+
+    vector<uint> from_neighbours, to_neighbours;
+    double max_cost = double(max_error)*max_error;
+    double worst_cost = 0;
+    while(live_triangles*3 > target_index_count && !queue.empty())
+    {
+        Collapse collapse = queue.top();
+        queue.pop();
+        uint s = collapse.from, t = collapse.to;
+        if(dead_point[s] || dead_point[t] || collapse.from_version != version[s] ||
+            collapse.to_version != version[t])
+            continue;
+        if(collapse.cost > max_cost)
+            break;
+
+        //Gather the neighbourhoods of both endpoints
+        from_neighbours.clear();
+        to_neighbours.clear();
+        uint shared_triangles = 0;
+        for(uint tri : point_triangles[s])
+        {
+            if(dead_triangle[tri])
+                continue;
+            bool has_t = false;
+            for(int k=0; k<3; k++)
+            {
+                from_neighbours.push_back(triangles[3*tri+k]);
+                has_t |= triangles[3*tri+k] == t;
+            }
+            shared_triangles += has_t;
+        }
+        if(shared_triangles == 0)
+            continue;
+        for(uint tri : point_triangles[t])
+            if(!dead_triangle[tri])
+                for(int k=0; k<3; k++)
+                    to_neighbours.push_back(triangles[3*tri+k]);
+        sort(from_neighbours.begin(), from_neighbours.end());
+        from_neighbours.erase(unique(from_neighbours.begin(), from_neighbours.end()),
+            from_neighbours.end());
+        sort(to_neighbours.begin(), to_neighbours.end());
+        to_neighbours.erase(unique(to_neighbours.begin(), to_neighbours.end()),
+            to_neighbours.end());
+
+        //Link condition, the endpoints (included in both lists) plus one vertex per
+        //triangle on the edge must be the only shared neighbours
+        uint common = 0;
+        for(uint i=0, j=0; i<from_neighbours.size() && j<to_neighbours.size();)
+        {
+            if(from_neighbours[i] < to_neighbours[j]) i++;
+            else if(from_neighbours[i] > to_neighbours[j]) j++;
+            else {common++; i++; j++;}
+        }
+        if(common > shared_triangles + 2)
+            continue;
+
+        //Reject collapses that flip or degenerate one of the remaining triangles
+        bool flips = false;
+        for(uint tri : point_triangles[s])
+        {
+            if(dead_triangle[tri])
+                continue;
+            uint *corners = &triangles[3*tri];
+            if(corners[0]==t || corners[1]==t || corners[2]==t)
+                continue;
+            vec3 p[3], moved[3];
+            for(int k=0; k<3; k++)
+            {
+                p[k] = points[corners[k]];
+                moved[k] = corners[k]==s? points[t] : p[k];
+            }
+            vec3 before = cross(p[1]-p[0], p[2]-p[0]);
+            vec3 after = cross(moved[1]-moved[0], moved[2]-moved[0]);
+            if(dot(before, after) <= 0)
+            {
+                flips = true;
+                break;
+            }
+        }
+        if(flips)
+            continue;
+
+        //Collapse s onto t
+        add_quadric(quadrics[t], quadrics[s]);
+        dead_point[s] = true;
+        version[t]++;
+        worst_cost = std::max(worst_cost, collapse.cost);
+        for(uint tri : point_triangles[s])
+        {
+            if(dead_triangle[tri])
+                continue;
+            uint *corners = &triangles[3*tri];
+            if(corners[0]==t || corners[1]==t || corners[2]==t)
+            {
+                dead_triangle[tri] = true;
+                live_triangles--;
+                continue;
+            }
+            for(int k=0; k<3; k++)
+                if(corners[k] == s)
+                    corners[k] = t;
+            point_triangles[t].push_back(tri);
+        }
+        point_triangles[s].clear();
+
+        vector<uint> &around = point_triangles[t];
+        around.erase(remove_if(around.begin(), around.end(),
+            [&dead_triangle](uint tri){return bool(dead_triangle[tri]);}), around.end());
+        for(uint tri : around)
+            for(int k=0; k<3; k++)
+                if(triangles[3*tri+k] != t)
+                    push_edge(t, triangles[3*tri+k]);
+    }
+    result_error = sqrt(worst_cost);
+
+    //Map the welded corners back to the original vertex with the closest normal
+    vector<uint> result;
+    result.reserve(live_triangles*3);
+    for(uint tri=0; tri<triangle_count; tri++)
+    {
+        if(dead_triangle[tri])
+            continue;
+        for(int k=0; k<3; k++)
+        {
+            uint original = indices[3*tri+k];
+            uint point = triangles[3*tri+k];
+            if(welded[original] == point)
+            {
+                result.push_back(original);
+                continue;
+            }
+            uint best = wedges[wedge_offsets[point]];
+            if(!normals.empty())
+            {
+                float best_dot = -FLT_MAX;
+                for(uint w=wedge_offsets[point]; w<wedge_offsets[point+1]; w++)
+                {
+                    float similarity = dot(normals[wedges[w]], normals[original]);
+                    if(similarity > best_dot)
+                    {
+                        best_dot = similarity;
+                        best = wedges[w];
+                    }
+                }
+            }
+            result.push_back(best);
+        }
+    }
+    return result;
+}
+
+//Simplify the levels of detail in parallel
+vector<Simplified_Mesh> generate_lod_chain(const vector<vec3> &positions,
+    const vector<vec3> &normals, const vector<uint> &indices)
+{
+    vector<Simplified_Mesh> levels(HELIOS_MAX_LOD_LEVELS);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int l=0; l<HELIOS_MAX_LOD_LEVELS; l++)
+    {
+        size_t target = size_t(indices.size()/3 * pow(HELIOS_LOD_REDUCTION, l+1))*3;
+        if(target < 3*HELIOS_LOD_MIN_TRIANGLES)
+            continue;
+        levels[l].indices = simplify_mesh(positions, normals, indices, target, FLT_MAX,
+            levels[l].error);
+    }
+
+    //Keep the levels that are smaller than the previous one, errors never decrease
+    vector<Simplified_Mesh> chain;
+    size_t previous_size = indices.size();
+    float previous_error = 0;
+    for(Simplified_Mesh &level : levels)
+    {
+        if(level.indices.empty() || level.indices.size() >= previous_size*0.9)
+            continue;
+        previous_size = level.indices.size();
+        level.error = std::max(level.error, previous_error);
+        previous_error = level.error;
+        chain.push_back(move(level));
+    }
+    return chain;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,96 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of quadric error metric mesh simplification
+ *
+ * @file Mesh-Simplifier.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+//########################################################################################
+
+/**
+ * @brief Maximum number of simplified levels generated for a mesh (the base excluded)
+ *
+*/
+#define HELIOS_MAX_LOD_LEVELS 4
+/**
+ * @brief Fraction of the triangles of the previous level kept by every level
+ *
+*/
+#define HELIOS_LOD_REDUCTION 0.5f
+/**
+ * @brief Levels with fewer triangles than this are not generated
+ *
+*/
+#define HELIOS_LOD_MIN_TRIANGLES 64
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief A simplified version of a mesh sharing the vertices of the original
+ *
+*/
+struct Simplified_Mesh
+{
+    std::vector<uint> indices;  //!< Triangle list indexing the original vertices
+    float error;                //!< Approximate object space distance to the original
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Simplify a triangle mesh with quadric error metric edge collapses
+ *
+ * Edges are collapsed onto one of their endpoints (Garland and Heckbert 1997 restricted
+ * to the existing vertices), so the result indexes the original vertex buffer. Vertices
+ * with the same position but different attributes are simplified as one and remapped
+ * to the copy with the most similar normal. Open borders are preserved by additional
+ * planes perpendicular to the border faces, and collapses that flip a face or break the
+ * manifold are rejected.
+ *
+ * @param positions Vertex positions
+ * @param normals Vertex normals, may be empty
+ * @param indices Triangle list
+ * @param target_index_count Stop once the result has at most this many indices
+ * @param max_error Stop before any collapse that would exceed this distance
+ * @param result_error Set to the error of the result
+ * @return std::vector<uint> The simplified triangle list
+*/
+std::vector<uint> simplify_mesh(const std::vector<glm::vec3> &positions,
+    const std::vector<glm::vec3> &normals, const std::vector<uint> &indices,
+    size_t target_index_count, float max_error, float &result_error);
+/**
+ * @brief Generate a chain of levels of detail of decreasing triangle count
+ *
+ * Every level keeps HELIOS_LOD_REDUCTION of the triangles of the previous one. The
+ * levels are simplified from the original mesh in parallel with OpenMP. Levels that do
+ * not reduce the triangle count any further are discarded.
+ *
+ * @param positions Vertex positions
+ * @param normals Vertex normals, may be empty
+ * @param indices Triangle list of the full resolution mesh
+ * @return std::vector<Simplified_Mesh> Levels ordered from finest to coarsest
+*/
+std::vector<Simplified_Mesh> generate_lod_chain(const std::vector<glm::vec3> &positions,
+    const std::vector<glm::vec3> &normals, const std::vector<uint> &indices);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,235 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the partition of meshes into culling clusters (meshlets)
+ *
+ * @file Meshlets.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Meshlets.hpp"
+#include "Mesh-Optimizer.hpp"
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Compute the bounding sphere and normal cone of a range of triangles
+ *
+ * @param meshlet Meshlet whose range is set, its culling data is filled
+ * @param indices Triangle list
+ * @param positions Vertex positions
+*/
+void static compute_meshlet_bounds(Helios::Meshlet &meshlet,
+    const vector<uint> &indices, const vector<vec3> &positions)
+{
+    uint first = meshlet.first_index, last = meshlet.first_index + meshlet.index_count;
+
+    //Sphere around the center of the bounding box
+    vec3 low = positions[indices[first]];
+    vec3 high = low;
+    for(uint i=first; i<last; i++)
+    {
+        low = glm::min(low, positions[indices[i]]);
+        high = glm::max(high, positions[indices[i]]);
+    }
+    meshlet.center = (low + high)*0.5f;
+    meshlet.radius = 0;
+    for(uint i=first; i<last; i++)
+        meshlet.radius = glm::max(meshlet.radius,
+            length(positions[indices[i]] - meshlet.center));
+
+    //Cone around the average of the unit face normals
+    vector<vec3> face_normals;
+    vec3 axis = vec3(0);
+    for(uint i=first; i<last; i+=3)
+    {
+        vec3 a = positions[indices[i]];
+        vec3 n = cross(positions[indices[i+1]] - a, positions[indices[i+2]] - a);
+        float n_length = length(n);
+        if(n_length == 0)
+            continue;
+        face_normals.push_back(n/n_length);
+        axis += face_normals.back();
+    }
+    float axis_length = length(axis);
+    meshlet.cone_axis = axis_length>0? axis/axis_length : vec3(0);
+    meshlet.cone_cutoff = 1;
+
+    float min_dot = 1;
+    for(vec3 &n : face_normals)
+        min_dot = glm::min(min_dot, dot(n, meshlet.cone_axis));
+    //Normals spread over more than a hemisphere can not be culled as a group
+    if(axis_length > 0 && min_dot > 0)
+        meshlet.cone_cutoff = sqrt(1 - min_dot*min_dot);
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Greedy meshlet construction
+vector<Meshlet> build_meshlets(vector<uint> &indices, const vector<vec3> &positions)
+{
+    vector<Meshlet> meshlets;
+    uint triangle_count = indices.size()/3;
+    size_t vertex_count = positions.size();
+    if(triangle_count == 0)
+        return meshlets;
+
+    //Position to triangle adjacency (CSR), triangles across hard edges and seams are
+    //neighbours even if they do not share vertices
+    vector<uint> welded;
+    uint point_count = weld_positions(positions, welded);
+    vector<uint> offsets(point_count+1, 0);
+    for(uint v : indices)
+        offsets[welded[v]+1]++;
+    for(uint p=0; p<point_count; p++)
+        offsets[p+1] += offsets[p];
+    vector<uint> adjacency(indices.size());
+    vector<uint> fill(offsets.begin(), offsets.end()-1);
+    for(uint i=0; i<indices.size(); i++)
+        adjacency[fill[welded[indices[i]]]++] = i/3;
+
+    //Meshlet that last used every vertex, to test membership without clearing
+    const uint none = 0xFFFFFFFFu;
+    vector<uint> vertex_owner(vertex_count, none);
+    vector<bool> assigned(triangle_count, false);
+    vector<uint> candidate_owner(triangle_count, none);
+    vector<uint> candidates;
+    vector<uint> output;
+    output.reserve(indices.size());
+
+    uint seed = 0;
+    while(true)
+    {
+        while(seed < triangle_count && assigned[seed])
+            seed++;
+        if(seed == triangle_count)
+            break;
+
+        Meshlet meshlet = {};
+        uint id = meshlets.size();
+        meshlet.first_index = output.size();
+        candidates.clear();
+        candidates.push_back(seed);
+        vec3 center_sum = vec3(0);
+        while(meshlet.index_count < 3*HELIOS_MESHLET_MAX_TRIANGLES)
+        {
+            //Pick the candidate that adds the fewest vertices to the meshlet, and among
+            //those the closest to its center to keep the meshlet compact
+            vec3 center = meshlet.vertex_count>0?
+                center_sum/float(meshlet.vertex_count) : vec3(0);
+            int best = -1;
+            uint best_new = 4;
+            float best_distance = 0;
+            for(uint c=0; c<candidates.size(); c++)
+            {
+                uint t = candidates[c];
+                uint new_vertices = 0;
+                for(int k=0; k<3; k++)
+                    new_vertices += vertex_owner[indices[3*t+k]] != id;
+                if(new_vertices > best_new)
+                    continue;
+                vec3 centroid = (positions[indices[3*t]] + positions[indices[3*t+1]] +
+                    positions[indices[3*t+2]])/3.f;
+                float distance = dot(centroid - center, centroid - center);
+                if(new_vertices < best_new || distance < best_distance)
+                {
+                    best_new = new_vertices;
+                    best_distance = distance;
+                    best = c;
+                }
+            }
+            if(best == -1 ||
+                meshlet.vertex_count + best_new > HELIOS_MESHLET_MAX_VERTICES)
+                break;
+
+            uint t = candidates[best];
+            candidates[best] = candidates.back();
+            candidates.pop_back();
+            assigned[t] = true;
+            meshlet.index_count += 3;
+            for(int k=0; k<3; k++)
+            {
+                uint v = indices[3*t+k];
+                output.push_back(v);
+                if(vertex_owner[v] == id)
+                    continue;
+                vertex_owner[v] = id;
+                meshlet.vertex_count++;
+                center_sum += positions[v];
+                //The triangles around a new vertex become candidates
+                for(uint a=offsets[welded[v]]; a<offsets[welded[v]+1]; a++)
+                {
+                    uint neighbour = adjacency[a];
+                    if(!assigned[neighbour] && candidate_owner[neighbour] != id)
+                    {
+                        candidate_owner[neighbour] = id;
+                        candidates.push_back(neighbour);
+                    }
+                }
+            }
+            //Drop the candidates that were assigned meanwhile
+            candidates.erase(remove_if(candidates.begin(), candidates.end(),
+                [&assigned](uint c){return bool(assigned[c]);}), candidates.end());
+        }
+        meshlets.push_back(meshlet);
+    }
+    indices.swap(output);
+
+    for(Meshlet &meshlet : meshlets)
+        compute_meshlet_bounds(meshlet, indices, positions);
+
+    return meshlets;
+}
+
+//Gribb and Hartmann plane extraction
+void extract_frustum_planes(const mat4 &matrix, vec4 planes[6])
+{
+    vec4 row[4];
+    for(int i=0; i<4; i++)
+        row[i] = vec4(matrix[0][i], matrix[1][i], matrix[2][i], matrix[3][i]);
+
+    planes[0] = row[3] + row[0];
+    planes[1] = row[3] - row[0];
+    planes[2] = row[3] + row[1];
+    planes[3] = row[3] - row[1];
+    planes[4] = row[3] + row[2];
+    planes[5] = row[3] - row[2];
+    for(int i=0; i<6; i++)
+        planes[i] /= length(vec3(planes[i]));
+}
+
+//Sphere and cone culling
+bool meshlet_visible(const Meshlet &meshlet, const vec4 planes[6], vec3 camera_position)
+{
+    for(int i=0; i<6; i++)
+        if(dot(vec3(planes[i]), meshlet.center) + planes[i].w < -meshlet.radius)
+            return false;
+
+    vec3 view = meshlet.center - camera_position;
+    return dot(view, meshlet.cone_axis) <
+        meshlet.cone_cutoff*length(view) + meshlet.radius;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
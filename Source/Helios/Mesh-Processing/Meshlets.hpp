@@ -0,0 +1,104 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the partition of meshes into culling clusters (meshlets)
+ *
+ * @file Meshlets.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+
+#include <cstdint>
+//########################################################################################
+
+/**
+ * @brief Maximum number of distinct vertices referenced by a meshlet
+ *
+*/
+#define HELIOS_MESHLET_MAX_VERTICES 64
+/**
+ * @brief Maximum number of triangles in a meshlet
+ *
+*/
+#define HELIOS_MESHLET_MAX_TRIANGLES 124
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief A cluster of neighbouring triangles and the data needed to cull it
+ *
+ * The triangles of a meshlet are a contiguous range of the index buffer of its mesh.
+ * The layout matches a std430 struct {vec4 sphere; vec4 cone; uvec4 range;} so the
+ * array can be uploaded as is to a shader storage buffer.
+*/
+struct Meshlet
+{
+    glm::vec3 center;       //!< Center of the bounding sphere
+    float radius;           //!< Radius of the bounding sphere
+    glm::vec3 cone_axis;    //!< Average direction of the normals of the triangles
+    float cone_cutoff;      //!< Sine of the half angle of the normal cone, 1 if unusable
+    uint32_t first_index;   //!< Offset in indices of the first triangle of the meshlet
+    uint32_t index_count;   //!< Number of indices of the meshlet
+    uint32_t vertex_count;  //!< Number of distinct vertices referenced by the meshlet
+    uint32_t padding;       //!< Unused, pads the structure to 16 bytes
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Split a triangle mesh into meshlets
+ *
+ * Meshlets are grown greedily from a seed triangle, always adding the neighbouring
+ * triangle that adds the fewest new vertices, until either limit is reached. The index
+ * buffer is reordered so the triangles of every meshlet are contiguous.
+ *
+ * @param indices Triangle list, reordered in place
+ * @param positions Vertex positions
+ * @return std::vector<Meshlet> The meshlets with their culling data
+*/
+std::vector<Meshlet> build_meshlets(std::vector<uint> &indices,
+    const std::vector<glm::vec3> &positions);
+/**
+ * @brief Extract the six clipping planes of a view volume
+ *
+ * Planes are stored as (normal, offset) with normals pointing inside the volume. For
+ * a projection*view*model matrix the planes are in the object space of the model.
+ *
+ * @param matrix Transformation to clip space
+ * @param planes Filled with the left, right, bottom, top, near and far planes
+*/
+void extract_frustum_planes(const glm::mat4 &matrix, glm::vec4 planes[6]);
+/**
+ * @brief Whether any triangle of a meshlet may be visible
+ *
+ * A meshlet is rejected if its bounding sphere is outside one of the planes, or if the
+ * camera lies in the region from which every triangle of the cluster faces away. Both
+ * tests assume the transformation to object space does not scale non uniformly.
+ *
+ * @param meshlet The meshlet to test
+ * @param planes Frustum planes in the object space of the mesh
+ * @param camera_position Position of the camera in the object space of the mesh
+ * @return true If the meshlet has to be drawn
+*/
+bool meshlet_visible(const Meshlet &meshlet, const glm::vec4 planes[6],
+    glm::vec3 camera_position);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,213 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of vertex normal generation for imported meshes
+ *
+ * @file Normal-Generation.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Normal-Generation.hpp"
+
+#include <omp.h>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Normalize an accumulated normal
+ *
+ * @param n Sum of face normals
+ * @return vec3 The unit normal, or +Y if every face around the vertex is degenerate
+*/
+vec3 inline static safe_normalize(vec3 n)
+{
+    float n_length = length(n);
+    return n_length>0? n/n_length : vec3(0,1,0);
+}
+/**
+ * @brief Area weighted normals of every triangle
+ *
+ * @param data The parsed file
+ * @return vector<vec3> The cross product of the edges of every triangle, whose length
+ *         is twice the area of the triangle
+*/
+vector<vec3> static face_normals(const Helios::Obj_Data &data)
+{
+    long triangle_count = data.corners.size()/3;
+    vector<vec3> normals(triangle_count);
+    #pragma omp parallel for schedule(static)
+    for(long t=0; t<triangle_count; t++)
+    {
+        vec3 a = data.positions[data.corners[3*t].x];
+        vec3 b = data.positions[data.corners[3*t+1].x];
+        vec3 c = data.positions[data.corners[3*t+2].x];
+        normals[t] = cross(b-a, c-a);
+    }
+    return normals;
+}
+/**
+ * @brief One smooth normal per position, accumulated in per thread arrays
+ *
+ * @param data The parsed file, normals are appended and missing corners updated
+ * @param faces Area weighted face normals
+*/
+void static smooth_normals(Helios::Obj_Data &data, const vector<vec3> &faces)
+{
+    long position_count = data.positions.size();
+    long triangle_count = faces.size();
+    size_t base = data.normals.size();
+    data.normals.resize(base + position_count);
+
+    vector<vector<vec3>> partial(omp_get_max_threads());
+    #pragma omp parallel
+    {
+        //Each thread sums the faces it visits into its own array, no atomics needed
+        vector<vec3> &sums = partial[omp_get_thread_num()];
+        sums.assign(position_count, vec3(0));
+        #pragma omp for schedule(static)
+        for(long t=0; t<triangle_count; t++)
+            for(int k=0; k<3; k++)
+                sums[data.corners[3*t+k].x] += faces[t];
+
+        //Implicit barrier above, then every thread reduces a range of positions
+        int thread_count = omp_get_num_threads();
+        #pragma omp for schedule(static)
+        for(long p=0; p<position_count; p++)
+        {
+            vec3 n = vec3(0);
+            for(int i=0; i<thread_count; i++)
+                n += partial[i][p];
+            data.normals[base + p] = safe_normalize(n);
+        }
+    }
+
+    long corner_count = data.corners.size();
+    #pragma omp parallel for schedule(static)
+    for(long c=0; c<corner_count; c++)
+        if(data.corners[c].z < 0)
+            data.corners[c].z = base + data.corners[c].x;
+}
+/**
+ * @brief Normals smoothed only across faces within a crease angle of each other
+ *
+ * @param data The parsed file, normals are appended and missing corners updated
+ * @param faces Area weighted face normals
+ * @param cos_crease Cosine of the crease angle
+*/
+void static creased_normals(Helios::Obj_Data &data, const vector<vec3> &faces,
+    float cos_crease)
+{
+    long position_count = data.positions.size();
+    long corner_count = data.corners.size();
+
+    vector<vec3> units(faces.size());
+    #pragma omp parallel for schedule(static)
+    for(long t=0; t<long(faces.size()); t++)
+        units[t] = safe_normalize(faces[t]);
+
+    //Corners around every position (CSR)
+    vector<uint> offsets(position_count+1, 0);
+    for(const ivec3 &corner : data.corners)
+        offsets[corner.x+1]++;
+    for(long p=0; p<position_count; p++)
+        offsets[p+1] += offsets[p];
+    vector<uint> around(corner_count);
+    vector<uint> fill(offsets.begin(), offsets.end()-1);
+    for(long c=0; c<corner_count; c++)
+        around[fill[data.corners[c].x]++] = c;
+
+    //Normal of every corner and its index among the distinct normals of its position
+    vector<vec3> corner_normals(corner_count);
+    vector<uint> local_id(corner_count);
+    vector<uint> normal_offsets(position_count+1, 0);
+    #pragma omp parallel
+    {
+        vector<vec3> distinct;
+        #pragma omp for schedule(dynamic, 4096)
+        for(long p=0; p<position_count; p++)
+        {
+            uint first = offsets[p], last = offsets[p+1];
+            distinct.clear();
+            for(uint i=first; i<last; i++)
+            {
+                uint face = around[i]/3;
+                vec3 n = vec3(0);
+                //The same faces summed in the same order give bit identical normals
+                for(uint j=first; j<last; j++)
+                    if(dot(units[face], units[around[j]/3]) >= cos_crease)
+                        n += faces[around[j]/3];
+                n = safe_normalize(n);
+
+                uint id = find(distinct.begin(), distinct.end(), n) - distinct.begin();
+                if(id == distinct.size())
+                    distinct.push_back(n);
+                corner_normals[around[i]] = n;
+                local_id[around[i]] = id;
+            }
+            normal_offsets[p+1] = distinct.size();
+        }
+    }
+    for(long p=0; p<position_count; p++)
+        normal_offsets[p+1] += normal_offsets[p];
+
+    //Store the distinct normals, corners with a normal in the file keep theirs
+    size_t base = data.normals.size();
+    data.normals.resize(base + normal_offsets[position_count]);
+    #pragma omp parallel for schedule(dynamic, 4096)
+    for(long p=0; p<position_count; p++)
+    {
+        for(uint i=offsets[p]; i<offsets[p+1]; i++)
+        {
+            uint c = around[i];
+            uint slot = base + normal_offsets[p] + local_id[c];
+            data.normals[slot] = corner_normals[c];
+            if(data.corners[c].z < 0)
+                data.corners[c].z = slot;
+        }
+    }
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Detect corners without normals
+bool missing_normals(const Obj_Data &data)
+{
+    for(const ivec3 &corner : data.corners)
+        if(corner.z < 0)
+            return true;
+    return false;
+}
+
+//Generate normals for the corners that lack one
+void generate_normals(Obj_Data &data, float crease_angle)
+{
+    vector<vec3> faces = face_normals(data);
+    if(crease_angle >= HELIOS_SMOOTH_NORMALS)
+        smooth_normals(data, faces);
+    else
+        creased_normals(data, faces, cos(radians(crease_angle)));
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
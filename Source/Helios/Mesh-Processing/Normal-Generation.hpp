@@ -0,0 +1,61 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of vertex normal generation for imported meshes
+ *
+ * @file Normal-Generation.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Obj-Loader.hpp"
+//########################################################################################
+
+/**
+ * @brief Crease angle in degrees that disables splitting, every corner is smoothed
+ *
+*/
+#define HELIOS_SMOOTH_NORMALS 180.f
+/**
+ * @brief Crease angle in degrees used for meshes imported with HELIOS_MESH_CREASE_NORMALS
+ *
+*/
+#define HELIOS_CREASE_ANGLE 60.f
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Whether any face corner of a parsed file lacks a normal
+ *
+ * @param data The parsed file
+*/
+bool missing_normals(const Obj_Data &data);
+/**
+ * @brief Compute area weighted normals for the corners that have none
+ *
+ * Face normals are weighted by the area of the face. Without a crease angle every
+ * position gets a single normal, accumulated in per thread arrays that are summed at
+ * the end. With a crease angle, the faces around each position are only averaged with
+ * the faces whose normal is within the angle of their own, so hard edges stay sharp.
+ * Corners that end up with the same normal share it, keeping vertices merged. Both
+ * paths run with OpenMP and without atomics.
+ *
+ * @param data The parsed file, generated normals are appended to its normal array
+ * @param crease_angle Maximum angle in degrees between smoothed faces
+*/
+void generate_normals(Obj_Data &data, float crease_angle = HELIOS_SMOOTH_NORMALS);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,598 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the wavefront (.obj) parser used by Helios meshes
+ *
+ * @file Obj-Loader.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Obj-Loader.hpp"
+#include "mapped_file.hpp"
+
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <omp.h>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+
+//Powers of ten that are exactly representable as doubles
+static const double powers_of_ten[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#define MAX_EXACT_POWER 22
+#define MAX_MANTISSA_DIGITS 19
+
+//Files smaller than this (in bytes) are parsed on a single thread
+#define PARALLEL_PARSE_THRESHOLD (4u<<20)
+//Number of chunks per worker thread, more chunks balance the load between threads
+#define CHUNKS_PER_THREAD 4
+
+//Whether a character separates tokens within a line
+bool inline static is_blank(char c){return c==' ' || c=='\t' || c=='\r';}
+//Whether a character is a decimal digit
+bool inline static is_digit(char c){return c>='0' && c<='9';}
+
+//Advance past spaces and tabs, stops at the end of the line
+const char inline static *skip_blanks(const char *p, const char *end)
+{
+    while(p<end && is_blank(*p))
+        p++;
+    return p;
+}
+//Advance to the first character of the next line
+const char inline static *skip_line(const char *p, const char *end)
+{
+    const char *next = (const char*) memchr(p, '\n', end-p);
+    return next==nullptr? end : next+1;
+}
+/**
+ * @brief Convert the decimal number starting at p into a float
+ *
+ * Accepts an optional sign, an integer part, a fractional part and an exponent. Digits
+ * beyond the precision of a 64 bit mantissa are ignored.
+ *
+ * @param p Position at which to start reading (leading blanks are skipped)
+ * @param end End of the buffer
+ * @param value Where to store the converted number
+ * @return const char* Position of the first character after the number
+*/
+const char inline static *parse_float(const char *p, const char *end, float &value)
+{
+    p = skip_blanks(p, end);
+
+    bool negative = false;
+    if(p<end && (*p=='-' || *p=='+'))
+        negative = *(p++)=='-';
+    //Accumulate all significant digits into an integer and track the decimal exponent
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    for(; p<end && is_digit(*p); p++)
+    {
+        if(digits < MAX_MANTISSA_DIGITS)
+        {
+            mantissa = mantissa*10 + (*p-'0');
+            digits += mantissa!=0;
+        }
+        else
+            exponent++;
+    }
+    if(p<end && *p=='.')
+    {
+        for(p++; p<end && is_digit(*p); p++)
+        {
+            if(digits < MAX_MANTISSA_DIGITS)
+            {
+                mantissa = mantissa*10 + (*p-'0');
+                digits += mantissa!=0;
+                exponent--;
+            }
+        }
+    }
+    if(p<end && (*p=='e' || *p=='E'))
+    {
+        p++;
+        bool negative_exponent = false;
+        if(p<end && (*p=='-' || *p=='+'))
+            negative_exponent = *(p++)=='-';
+        int e = 0;
+        for(; p<end && is_digit(*p); p++)
+            if(e < 10000)
+                e = e*10 + (*p-'0');
+        exponent += negative_exponent? -e : e;
+    }
+    //Scale by the exponent using exact powers of ten
+    double result = double(mantissa);
+    int e = exponent<0? -exponent : exponent;
+    while(e > MAX_EXACT_POWER && result != 0)
+    {
+        result = exponent<0? result/powers_of_ten[MAX_EXACT_POWER] :
+            result*powers_of_ten[MAX_EXACT_POWER];
+        e -= MAX_EXACT_POWER;
+    }
+    if(e <= MAX_EXACT_POWER)
+        result = exponent<0? result/powers_of_ten[e] : result*powers_of_ten[e];
+
+    value = float(negative? -result : result);
+    return p;
+}
+/**
+ * @brief Convert the (possibly signed) integer starting at p
+ *
+ * @param p Position at which to start reading
+ * @param end End of the buffer
+ * @param value Where to store the number, 0 if there were no digits
+ * @return const char* Position of the first character after the number
+*/
+const char inline static *parse_int(const char *p, const char *end, int &value)
+{
+    bool negative = false;
+    if(p<end && (*p=='-' || *p=='+'))
+        negative = *(p++)=='-';
+
+    int result = 0;
+    for(; p<end && is_digit(*p); p++)
+        result = result*10 + (*p-'0');
+
+    value = negative? -result : result;
+    return p;
+}
+/**
+ * @brief Region of a wavefront file parsed independently of the rest of the file
+ *
+ * Negative (relative) face indices can only be resolved once it is known how many
+ * attributes precede the chunk. Those indices are stored relative to the start of the
+ * chunk and their location is recorded so they can be corrected when chunks are merged.
+*/
+struct Obj_Chunk
+{
+    Helios::Obj_Data data;      //!< Elements found in the chunk
+    vector<size_t> relative;    //!< Corner component (3*corner + axis) of relative indices
+};
+/**
+ * @brief Read the rest of a line as a name, without surrounding blanks
+ *
+ * @param p Position right after the keyword
+ * @param end End of the buffer
+ * @return string The name, may contain spaces
+*/
+string inline static parse_name(const char *p, const char *end)
+{
+    p = skip_blanks(p, end);
+    const char *last = (const char*) memchr(p, '\n', end-p);
+    if(last == nullptr)
+        last = end;
+    while(last>p && is_blank(last[-1]))
+        last--;
+    return string(p, last);
+}
+/**
+ * @brief Whether a line starts with a keyword followed by a blank
+ *
+ * @param p Start of the line
+ * @param end End of the buffer
+ * @param keyword The keyword
+ * @param length Length of the keyword
+*/
+bool inline static has_keyword(const char *p, const char *end, const char *keyword,
+    size_t length)
+{
+    return size_t(end-p) > length && memcmp(p, keyword, length)==0 && is_blank(p[length]);
+}
+/**
+ * @brief Record a "usemtl" line in a chunk
+ *
+ * Names are numbered in the order the chunk first uses them.
+ *
+ * @param name The material name
+ * @param data Elements of the chunk
+*/
+void inline static use_material(const string &name, Helios::Obj_Data &data)
+{
+    int id = find(data.material_names.begin(), data.material_names.end(), name) -
+        data.material_names.begin();
+    if(id == int(data.material_names.size()))
+        data.material_names.push_back(name);
+    data.material_changes.push_back(ivec2(data.corners.size(), id));
+}
+//Index of an omitted uv or normal until the corners are validated, a relative index
+//that resolves to a negative value must not be mistaken for it
+#define OMITTED_INDEX INT_MIN
+/**
+ * @brief Turn a one based (or negative, relative) wavefront index into a zero based one
+ *
+ * @param index The index as written in the file, 0 if it was omitted
+ * @param count Number of elements of that attribute read so far in the chunk
+ * @return int The zero based index (relative to the chunk if index was negative) or
+ *         OMITTED_INDEX if the index was omitted
+*/
+int inline static resolve_index(int index, size_t count)
+{
+    if(index > 0)
+        return index - 1;
+    if(index < 0)
+        return int(count) + index;
+    return OMITTED_INDEX;
+}
+/**
+ * @brief Read the vertices of a face line and store it as a triangle fan
+ *
+ * @param p Position right after the 'f' token
+ * @param end End of the buffer
+ * @param chunk The chunk being built, its attribute counts resolve relative indices
+ * @param polygon Scratch space for the corners of the polygon
+ * @param relative Scratch space for the mask of relative components of each corner
+*/
+void inline static parse_face(const char *p, const char *end, Obj_Chunk &chunk,
+    vector<ivec3> &polygon, vector<int> &relative)
+{
+    Helios::Obj_Data &data = chunk.data;
+    polygon.clear();
+    relative.clear();
+    p = skip_blanks(p, end);
+    while(p<end && *p!='\n')
+    {
+        //Each corner is one of v, v/vt, v//vn or v/vt/vn
+        int v = 0, t = 0, n = 0;
+        p = parse_int(p, end, v);
+        if(p<end && *p=='/')
+        {
+            p++;
+            if(p<end && *p!='/')
+                p = parse_int(p, end, t);
+            if(p<end && *p=='/')
+                p = parse_int(p+1, end, n);
+        }
+        polygon.push_back(ivec3(
+            resolve_index(v, data.positions.size()),
+            resolve_index(t, data.uvs.size()),
+            resolve_index(n, data.normals.size())));
+        relative.push_back((v<0) | (t<0)<<1 | (n<0)<<2);
+        //Skip anything unexpected left in the token so the loop always advances
+        while(p<end && !is_blank(*p) && *p!='\n')
+            p++;
+        p = skip_blanks(p, end);
+    }
+    //Triangulate as a fan around the first corner
+    for(uint i=2; i<polygon.size(); i++)
+    {
+        uint fan[] = {0, i-1, i};
+        for(uint corner : fan)
+        {
+            for(int axis=0; axis<3; axis++)
+                if(relative[corner] & (1<<axis))
+                    chunk.relative.push_back(3*data.corners.size() + axis);
+            data.corners.push_back(polygon[corner]);
+        }
+    }
+}
+/**
+ * @brief Parse a region of a wavefront file, the region must start at a line boundary
+ *
+ * @param p Start of the region
+ * @param end End of the region
+ * @param chunk Chunk to which the parsed elements are appended
+*/
+void static parse_obj_range(const char *p, const char *end, Obj_Chunk &chunk)
+{
+    Helios::Obj_Data &data = chunk.data;
+    vector<ivec3> polygon;
+    vector<int> relative;
+    while(p<end)
+    {
+        p = skip_blanks(p, end);
+        if(p>=end)
+            break;
+
+        char next = p+1<end? p[1] : '\n';
+        //Vertex attribute lines: "v", "vt" and "vn"
+        if(p[0]=='v')
+        {
+            if(is_blank(next))
+            {
+                vec3 v;
+                p = parse_float(p+1, end, v.x);
+                p = parse_float(p, end, v.y);
+                p = parse_float(p, end, v.z);
+                data.positions.push_back(v);
+            }
+            else if(next=='t' && p+2<end && is_blank(p[2]))
+            {
+                vec2 t;
+                p = parse_float(p+2, end, t.x);
+                p = parse_float(p, end, t.y);
+                data.uvs.push_back(t);
+            }
+            else if(next=='n' && p+2<end && is_blank(p[2]))
+            {
+                vec3 n;
+                p = parse_float(p+2, end, n.x);
+                p = parse_float(p, end, n.y);
+                p = parse_float(p, end, n.z);
+                data.normals.push_back(n);
+            }
+        }
+        //Face lines
+        else if(p[0]=='f' && is_blank(next))
+            parse_face(p+1, end, chunk, polygon, relative);
+        //Material lines, rare enough not to need a fast path
+        else if(has_keyword(p, end, "usemtl", 6))
+            use_material(parse_name(p+6, end), data);
+        else if(has_keyword(p, end, "mtllib", 6))
+            data.material_libraries.push_back(parse_name(p+6, end));
+
+        //Everything else (comments, groups, smoothing groups...) is ignored
+        p = skip_line(p, end);
+    }
+}
+/**
+ * @brief Split a file into line aligned chunks, parse them concurrently and merge them
+ *
+ * The per chunk attribute counts are prefix summed to find where every chunk goes in
+ * the final arrays, relative indices are shifted by the same amounts. The merged result
+ * is identical to parsing the whole file as a single chunk.
+ *
+ * @param begin Start of the file
+ * @param end End of the file
+ * @param chunk_count Number of chunks in which to split the file
+ * @param data Structure to fill with the contents of the file
+*/
+void static parse_obj_parallel(const char *begin, const char *end, int chunk_count,
+    Helios::Obj_Data &data)
+{
+    //Chunk boundaries, each one is moved forward to the start of a line
+    size_t size = end - begin;
+    vector<const char*> bounds(chunk_count+1);
+    bounds[0] = begin;
+    bounds[chunk_count] = end;
+    for(int i=1; i<chunk_count; i++)
+        bounds[i] = max(bounds[i-1], skip_line(begin + size*i/chunk_count, end));
+
+    vector<Obj_Chunk> chunks(chunk_count);
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int i=0; i<chunk_count; i++)
+        parse_obj_range(bounds[i], bounds[i+1], chunks[i]);
+
+    //Exclusive prefix sum of the element counts of every chunk
+    vector<size_t> v_base(chunk_count+1, 0), t_base(chunk_count+1, 0);
+    vector<size_t> n_base(chunk_count+1, 0), c_base(chunk_count+1, 0);
+    for(int i=0; i<chunk_count; i++)
+    {
+        v_base[i+1] = v_base[i] + chunks[i].data.positions.size();
+        t_base[i+1] = t_base[i] + chunks[i].data.uvs.size();
+        n_base[i+1] = n_base[i] + chunks[i].data.normals.size();
+        c_base[i+1] = c_base[i] + chunks[i].data.corners.size();
+    }
+
+    data.positions.resize(v_base[chunk_count]);
+    data.uvs.resize(t_base[chunk_count]);
+    data.normals.resize(n_base[chunk_count]);
+    data.corners.resize(c_base[chunk_count]);
+    //Material names are numbered per chunk, renumber them in order of first use
+    for(int i=0; i<chunk_count; i++)
+    {
+        Helios::Obj_Data &chunk = chunks[i].data;
+        data.material_libraries.insert(data.material_libraries.end(),
+            chunk.material_libraries.begin(), chunk.material_libraries.end());
+        for(ivec2 change : chunk.material_changes)
+        {
+            const string &name = chunk.material_names[change.y];
+            int id = find(data.material_names.begin(), data.material_names.end(), name) -
+                data.material_names.begin();
+            if(id == int(data.material_names.size()))
+                data.material_names.push_back(name);
+            data.material_changes.push_back(ivec2(change.x + c_base[i], id));
+        }
+    }
+    //Copy every chunk to its final place, releasing the chunk's memory as we go
+    #pragma omp parallel for schedule(dynamic, 1)
+    for(int i=0; i<chunk_count; i++)
+    {
+        Obj_Chunk &chunk = chunks[i];
+        int offsets[] = {int(v_base[i]), int(t_base[i]), int(n_base[i])};
+        for(size_t component : chunk.relative)
+            chunk.data.corners[component/3][component%3] += offsets[component%3];
+
+        copy(chunk.data.positions.begin(), chunk.data.positions.end(),
+            data.positions.begin() + v_base[i]);
+        copy(chunk.data.uvs.begin(), chunk.data.uvs.end(), data.uvs.begin() + t_base[i]);
+        copy(chunk.data.normals.begin(), chunk.data.normals.end(),
+            data.normals.begin() + n_base[i]);
+        copy(chunk.data.corners.begin(), chunk.data.corners.end(),
+            data.corners.begin() + c_base[i]);
+        chunk = Obj_Chunk();
+    }
+}
+/**
+ * @brief Verify every face corner refers to an attribute that exists
+ *
+ * Omitted uv and normal indices are turned into -1 on the way.
+ *
+ * @param data The parsed file
+ * @return true If all indices are valid
+*/
+bool static validate_corners(Helios::Obj_Data &data)
+{
+    int v_count = data.positions.size();
+    int t_count = data.uvs.size();
+    int n_count = data.normals.size();
+    for(ivec3 &c : data.corners)
+    {
+        if(c.y == OMITTED_INDEX)
+            c.y = -1;
+        else if(c.y<0 || c.y>=t_count)
+            return false;
+        if(c.z == OMITTED_INDEX)
+            c.z = -1;
+        else if(c.z<0 || c.z>=n_count)
+            return false;
+        if(c.x<0 || c.x>=v_count)
+            return false;
+    }
+    return true;
+}
+/**
+ * @brief Hash a corner triplet
+ *
+ * @param corner The (position, uv, normal) indices
+ * @return uint32_t The hash value
+*/
+uint32_t inline static hash_corner(const ivec3 &corner)
+{
+    uint32_t h = uint32_t(corner.x)*73856093u ^ uint32_t(corner.y)*19349663u ^
+        uint32_t(corner.z)*83492791u;
+    //Murmur finalizer to spread the bits over the whole word
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+//Value of an unused slot in the corner hash table
+#define EMPTY_SLOT 0xFFFFFFFFu
+/**
+ * @brief Insert every slot of a table into a new table twice the size
+ *
+ * @param table The open addressing table, its size must be a power of 2
+ * @param unique The corner triplet of every vertex in the table
+*/
+void static grow_table(vector<uint32_t> &table, vector<ivec3> &unique)
+{
+    vector<uint32_t> bigger(table.size()*2, EMPTY_SLOT);
+    uint32_t mask = bigger.size() - 1;
+    for(uint32_t vertex : table)
+    {
+        if(vertex == EMPTY_SLOT)
+            continue;
+        uint32_t slot = hash_corner(unique[vertex]) & mask;
+        while(bigger[slot] != EMPTY_SLOT)
+            slot = (slot + 1) & mask;
+        bigger[slot] = vertex;
+    }
+    table.swap(bigger);
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Load a wavefront file into memory
+bool load_obj(string file_path, Obj_Data &data)
+{
+    Helpers::Mapped_File file(file_path);
+    if(!file.is_open())
+    {
+        cerr << "Unable to open file " << file_path << " when creating mesh" <<endl;
+        Log::record_log(
+            string(80, '!') +
+            "\nError with file " + file_path + " when creating mesh\n" +
+            string(80, '!')
+            );
+        return false;
+    }
+
+    //Small files are not worth the cost of splitting and merging
+    const char *begin = file.data();
+    const char *end = begin + file.size();
+    int threads = omp_get_max_threads();
+    if(threads > 1 && file.size() >= PARALLEL_PARSE_THRESHOLD)
+    {
+        data = Obj_Data();
+        parse_obj_parallel(begin, end, threads*CHUNKS_PER_THREAD, data);
+    }
+    else
+    {
+        Obj_Chunk chunk;
+        parse_obj_range(begin, end, chunk);
+        data = move(chunk.data);
+    }
+
+    if(!validate_corners(data))
+    {
+        cerr << "Malformed wavefront file " << file_path <<
+            ", a face refers to a missing vertex attribute" << endl;
+        Log::record_log(
+            string(80, '!') +
+            "\nMalformed wavefront file: " + file_path + "\n" +
+            "A face refers to a missing vertex attribute\n" +
+            string(80, '!')
+            );
+        return false;
+    }
+
+    return true;
+}
+
+//Merge identical corners into shared vertices
+void build_indexed_mesh(Obj_Data &data, vector<vec3> &positions, vector<vec3> &normals,
+    vector<vec2> &uvs, vector<uint> &indices)
+{
+    //Open addressing table mapping a corner triplet to the vertex it created. Slots
+    //only store the vertex index, the triplet itself is kept in the unique array
+    size_t capacity = 1024;
+    while(capacity < data.corners.size()/2)
+        capacity *= 2;
+    vector<uint32_t> table(capacity, EMPTY_SLOT);
+    vector<ivec3> unique;
+    unique.reserve(data.corners.size()/4);
+
+    indices.clear();
+    indices.reserve(data.corners.size());
+    for(ivec3 &corner : data.corners)
+    {
+        //Keep the load factor under one half
+        if(unique.size()*2 >= table.size())
+            grow_table(table, unique);
+
+        uint32_t mask = table.size() - 1;
+        uint32_t slot = hash_corner(corner) & mask;
+        while(table[slot] != EMPTY_SLOT && unique[table[slot]] != corner)
+            slot = (slot + 1) & mask;
+
+        if(table[slot] == EMPTY_SLOT)
+        {
+            table[slot] = unique.size();
+            unique.push_back(corner);
+        }
+        indices.push_back(table[slot]);
+    }
+    //Gather the attributes of every distinct vertex
+    positions.resize(unique.size());
+    normals.resize(unique.size());
+    uvs.resize(unique.size());
+    for(uint i=0; i<unique.size(); i++)
+    {
+        ivec3 &corner = unique[i];
+        positions[i] = data.positions[corner.x];
+        uvs[i] = corner.y<0? vec2(0) : data.uvs[corner.y];
+        normals[i] = corner.z<0? vec3(0) : data.normals[corner.z];
+    }
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,93 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the wavefront (.obj) parser used by Helios meshes
+ *
+ * @file Obj-Loader.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Raw contents of a wavefront file
+ *
+ * The attribute arrays hold the "v", "vt" and "vn" entries in the order they appear in
+ * the file. Faces are triangulated as fans and stored as one entry per triangle corner.
+ * Every "usemtl" line is recorded as the corner from which its material applies.
+*/
+struct Obj_Data
+{
+    std::vector<glm::vec3> positions;   //!< Vertex positions ("v" lines)
+    std::vector<glm::vec2> uvs;         //!< Texture coordinates ("vt" lines)
+    std::vector<glm::vec3> normals;     //!< Vertex normals ("vn" lines)
+    /**
+     * @brief Zero based (position, uv, normal) indices of every triangle corner
+     *
+     * Missing uv or normal indices are stored as -1.
+    */
+    std::vector<glm::ivec3> corners;
+
+    std::vector<std::string> material_libraries;   //!< Files named by "mtllib" lines
+    std::vector<std::string> material_names;        //!< Distinct "usemtl" names
+    /**
+     * @brief (first corner, index in material_names) of every "usemtl" line
+     *
+     * Corners before the first entry have no material.
+    */
+    std::vector<glm::ivec2> material_changes;
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Parse a wavefront file
+ *
+ * The file is memory mapped and scanned a single time, numbers are converted in place
+ * without intermediate strings. Large files are split into line aligned chunks that are
+ * parsed concurrently by the OpenMP threads, the result is the same as a serial parse.
+ *
+ * @param file_path Path to the .obj file
+ * @param data Structure to fill with the contents of the file
+ * @return true If the file was read and all face indices refer to existing attributes
+ * @return false If the file could not be opened or is malformed
+*/
+bool load_obj(std::string file_path, Obj_Data &data);
+/**
+ * @brief Build an indexed vertex set from the corners of a wavefront file
+ *
+ * Every distinct (position, uv, normal) triplet becomes a single vertex, the corners are
+ * turned into indices into the resulting vertex arrays. Missing attributes are zero
+ * filled.
+ *
+ * @param data The parsed file
+ * @param positions Array to fill with the vertex positions
+ * @param normals Array to fill with the vertex normals
+ * @param uvs Array to fill with the vertex texture coordinates
+ * @param indices Array to fill with 3 indices per triangle
+*/
+void build_indexed_mesh(Obj_Data &data, std::vector<glm::vec3> &positions,
+    std::vector<glm::vec3> &normals, std::vector<glm::vec2> &uvs,
+    std::vector<uint> &indices);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,201 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the conversion of meshes to the paged format (.hpage files)
+ *
+ * @file Paged-Mesh.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Paged-Mesh.hpp"
+#include "Obj-Loader.hpp"
+#include "Normal-Generation.hpp"
+#include "Meshlets.hpp"
+#include "Helios-Wrappers.hpp"
+
+#include <cstring>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+/**
+ * @brief Gather the vertices of a page and remap its indices to them
+ *
+ * @param indices Indices of the whole mesh
+ * @param first First index of the page
+ * @param count Number of indices of the page
+ * @param local Page index of every mesh vertex, unused entries are 0xFFFFFFFF and are
+ *        left that way
+ * @param page_vertices Set to the mesh vertices of the page, in order of first use
+ * @param page_indices Set to the indices of the page into page_vertices
+*/
+static void collect_page(const vector<uint> &indices, uint first, uint count,
+    vector<uint> &local, vector<uint> &page_vertices, vector<uint16_t> &page_indices)
+{
+    const uint unused = 0xFFFFFFFFu;
+    page_vertices.clear();
+    page_indices.clear();
+    for(uint i=first; i<first+count; i++)
+    {
+        if(local[indices[i]] == unused)
+        {
+            local[indices[i]] = page_vertices.size();
+            page_vertices.push_back(indices[i]);
+        }
+        page_indices.push_back(local[indices[i]]);
+    }
+    for(uint v : page_vertices)
+        local[v] = unused;
+}
+
+//Split a mesh into self contained pages
+bool write_paged_mesh(string obj_path, string output_path, uint triangles_per_page)
+{
+    Obj_Data data;
+    if(!load_obj(obj_path, data))
+        return false;
+    if(missing_normals(data))
+        generate_normals(data);
+    vector<vec3> positions, normals;
+    vector<vec2> uvs;
+    vector<uint> indices;
+    build_indexed_mesh(data, positions, normals, uvs, indices);
+    data = Obj_Data();
+
+    //Meshlets are compact, consecutive meshlets are close to each other
+    vector<Meshlet> meshlets = build_meshlets(indices, positions);
+
+    Paged_Mesh_Header header = {};
+    memcpy(header.magic, "HPAG", 4);
+    header.version = HPAGE_VERSION;
+    header.vertex_stride = sizeof(Interleaved_Vertex);
+    vec3 low = positions.empty()? vec3(0) : positions[0];
+    vec3 high = low;
+    for(vec3 &p : positions)
+    {
+        low = glm::min(low, p);
+        high = glm::max(high, p);
+    }
+    for(int i=0; i<3; i++)
+    {
+        header.bounds_min[i] = low[i];
+        header.bounds_max[i] = high[i];
+    }
+
+    //Group meshlets into pages, a page never needs more than 16 bit indices
+    vector<Paged_Mesh_Page> pages;
+    vector<uint> page_first_meshlet;
+    for(uint m=0; m<meshlets.size(); m++)
+    {
+        bool full = pages.empty() ||
+            pages.back().index_count + meshlets[m].index_count > 3*triangles_per_page ||
+            pages.back().vertex_count + meshlets[m].index_count > 0xFFFF;
+        if(full)
+        {
+            pages.push_back({});
+            page_first_meshlet.push_back(m);
+        }
+        //Vertex counts are bounded by the index count until the page is built
+        pages.back().index_count += meshlets[m].index_count;
+        pages.back().vertex_count += meshlets[m].index_count;
+    }
+    page_first_meshlet.push_back(meshlets.size());
+
+    //First pass, find the vertices and bounds of every page to lay the file out
+    const uint unused = 0xFFFFFFFFu;
+    vector<uint> local(positions.size(), unused);
+    vector<uint> page_vertices;
+    vector<uint16_t> page_indices;
+    uint64_t offset = sizeof(Paged_Mesh_Header) + pages.size()*sizeof(Paged_Mesh_Page);
+    for(uint p=0; p<pages.size(); p++)
+    {
+        uint first = meshlets[page_first_meshlet[p]].first_index;
+        collect_page(indices, first, pages[p].index_count, local, page_vertices,
+            page_indices);
+
+        vec3 page_low = positions[page_vertices[0]];
+        vec3 page_high = page_low;
+        for(uint v : page_vertices)
+        {
+            page_low = glm::min(page_low, positions[v]);
+            page_high = glm::max(page_high, positions[v]);
+        }
+        vec3 center = (page_low + page_high)*0.5f;
+        float radius = 0;
+        for(uint v : page_vertices)
+            radius = glm::max(radius, length(positions[v] - center));
+
+        pages[p].vertex_count = page_vertices.size();
+        for(int i=0; i<3; i++)
+            pages[p].center[i] = center[i];
+        pages[p].radius = radius;
+
+        uint64_t page_size = page_vertices.size()*sizeof(Interleaved_Vertex) +
+            page_indices.size()*sizeof(uint16_t);
+        header.max_page_size = std::max(header.max_page_size, page_size);
+        offset = (offset + HPAGE_ALIGNMENT-1) / HPAGE_ALIGNMENT * HPAGE_ALIGNMENT;
+        pages[p].offset = offset;
+        offset += page_size;
+    }
+    header.page_count = pages.size();
+
+    //Write to a temporary file and rename it so readers never see a partial file
+    string temporary = output_path + "." + to_string(getpid()) + ".tmp";
+    ofstream output(temporary, ios::binary | ios::trunc);
+    if(!output)
+        return false;
+    output.write((const char*)&header, sizeof(header));
+    output.write((const char*)pages.data(), pages.size()*sizeof(Paged_Mesh_Page));
+
+    //Second pass, build each page again and write it as soon as it is built
+    vector<char> padding(HPAGE_ALIGNMENT, 0);
+    vector<Interleaved_Vertex> vertices;
+    uint64_t position = sizeof(Paged_Mesh_Header) + pages.size()*sizeof(Paged_Mesh_Page);
+    for(uint p=0; p<pages.size() && output; p++)
+    {
+        uint first = meshlets[page_first_meshlet[p]].first_index;
+        collect_page(indices, first, pages[p].index_count, local, page_vertices,
+            page_indices);
+        vertices.clear();
+        for(uint source : page_vertices)
+            vertices.push_back({positions[source], normals[source], uvs[source]});
+
+        output.write(padding.data(), pages[p].offset - position);
+        output.write((const char*)vertices.data(),
+            vertices.size()*sizeof(Interleaved_Vertex));
+        output.write((const char*)page_indices.data(),
+            page_indices.size()*sizeof(uint16_t));
+        position = pages[p].offset + vertices.size()*sizeof(Interleaved_Vertex) +
+            page_indices.size()*sizeof(uint16_t);
+    }
+    output.close();
+
+    if(!output || rename(temporary.c_str(), output_path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+        Log::record_log("Could not write paged mesh " + output_path + " for " + obj_path);
+        return false;
+    }
+    return true;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,101 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the paged mesh format (.hpage files) used for streaming
+ *
+ * @file Paged-Mesh.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+
+#include <cstdint>
+//########################################################################################
+
+/**
+ * @brief Version of the .hpage format, files with any other version are rejected
+ *
+*/
+#define HPAGE_VERSION 1
+/**
+ * @brief Alignment in bytes of the data of every page inside a .hpage file
+ *
+*/
+#define HPAGE_ALIGNMENT 4096
+/**
+ * @brief Default maximum number of triangles in a page
+ *
+*/
+#define HELIOS_PAGE_TRIANGLES 16384
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Header at the start of every .hpage file
+ *
+ * The header is followed by a table of page_count Paged_Mesh_Page and then by the data
+ * of every page. A page is self contained, it stores vertex_count Interleaved_Vertex
+ * followed by index_count 16 bit indices relative to its first vertex.
+*/
+struct Paged_Mesh_Header
+{
+    char magic[4];          //!< Always "HPAG"
+    uint32_t version;       //!< HPAGE_VERSION at the time of writing
+    uint32_t page_count;    //!< Number of pages in the file
+    uint32_t vertex_stride; //!< Size in bytes of a vertex
+    uint64_t max_page_size; //!< Size in bytes of the data of the largest page
+    float bounds_min[3];    //!< Minimum corner of the axis aligned bounding box
+    float bounds_max[3];    //!< Maximum corner of the axis aligned bounding box
+};
+/**
+ * @brief Location and bounds of a page inside a .hpage file
+ *
+*/
+struct Paged_Mesh_Page
+{
+    uint64_t offset;        //!< Offset in bytes of the page data in the file
+    uint32_t vertex_count;  //!< Number of vertices of the page
+    uint32_t index_count;   //!< Number of indices of the page
+    float center[3];        //!< Center of the bounding sphere of the page
+    float radius;           //!< Radius of the bounding sphere of the page
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Convert a wavefront file into a paged mesh for streaming
+ *
+ * This is an offline step. Pages are written to the file as they are built, but the
+ * indexed mesh and its meshlets stay in memory during the conversion. That is about 36
+ * bytes per vertex and 4 per index, on top of the parsed .obj while it is indexed. A
+ * model that does not fit in the memory of the converting machine cannot be paged,
+ * even though the runtime only ever holds a few of its pages.
+ * Pages are groups of neighbouring meshlets, so they are spatially compact and can be
+ * culled as a whole.
+ *
+ * @param obj_path Path to the .obj file
+ * @param output_path Path of the .hpage file to create
+ * @param triangles_per_page Maximum number of triangles in a page
+ * @return true If the file was written
+*/
+bool write_paged_mesh(std::string obj_path, std::string output_path,
+    uint triangles_per_page = HELIOS_PAGE_TRIANGLES);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,103 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of functions packing vertex attributes into compact formats
+ *
+ * @file Quantization.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Quantization.hpp"
+
+#include <cstring>
+#include <cmath>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Extent of a box, never 0 along an axis
+vec3 quantization_extent(vec3 bounds_min, vec3 bounds_max)
+{
+    vec3 extent = bounds_max - bounds_min;
+    for(int i=0; i<3; i++)
+        if(!(extent[i] > 0))
+            extent[i] = 1;
+    return extent;
+}
+
+//Map a position to the 16 bit grid spanning the bounding box
+void quantize_position(vec3 position, vec3 bounds_min, vec3 bounds_max, uint16_t packed[4])
+{
+    vec3 unit = (position - bounds_min) / quantization_extent(bounds_min, bounds_max);
+    for(int i=0; i<3; i++)
+        packed[i] = uint16_t(lround(glm::clamp(unit[i], 0.f, 1.f) * 65535.f));
+    packed[3] = 0;
+}
+
+//Pack a normal into 10 bits per component
+uint32_t pack_normal(vec3 normal)
+{
+    uint32_t packed = 0;
+    for(int i=0; i<3; i++)
+    {
+        int component = int(lround(glm::clamp(normal[i], -1.f, 1.f) * 511.f));
+        packed |= (uint32_t(component) & 0x3FF) << (10*i);
+    }
+    return packed;
+}
+
+//Convert to half precision
+uint16_t float_to_half(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = (bits >> 16) & 0x8000;
+    int exponent = int((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    //NaN and infinity
+    if(((bits >> 23) & 0xFF) == 0xFF)
+        return sign | 0x7C00 | (mantissa? 0x200 : 0);
+    //Overflow
+    if(exponent >= 31)
+        return sign | 0x7C00;
+    //Underflow to denormals or zero
+    if(exponent <= 0)
+    {
+        if(exponent < -10)
+            return sign;
+        mantissa |= 0x800000;
+        int shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if(remainder > halfway || (remainder == halfway && (half & 1)))
+            half++;
+        return sign | half;
+    }
+    //Normal numbers, round to nearest even (a carry correctly bumps the exponent)
+    uint32_t half = (uint32_t(exponent) << 10) | (mantissa >> 13);
+    uint32_t remainder = mantissa & 0x1FFF;
+    if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+        half++;
+    return sign | half;
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,72 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of functions packing vertex attributes into compact formats
+ *
+ * @file Quantization.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+
+#include <cstdint>
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Convert a position to 16 bit unsigned normalized coordinates
+ *
+ * The position is mapped from the box [bounds_min, bounds_max] to [0, 65535] on every
+ * axis. It is recovered as value/65535 * (bounds_max-bounds_min) + bounds_min.
+ *
+ * @param position The position to convert
+ * @param bounds_min Minimum corner of the bounding box of the mesh
+ * @param bounds_max Maximum corner of the bounding box of the mesh
+ * @param packed Where to write the 4 components (the last one is always 0 and only
+ *        there to keep every position 8 byte aligned)
+*/
+void quantize_position(glm::vec3 position, glm::vec3 bounds_min, glm::vec3 bounds_max,
+    uint16_t packed[4]);
+/**
+ * @brief Get the extent of a bounding box used to dequantize positions
+ *
+ * Flat axes get an extent of 1 so quantization never divides by 0.
+ *
+ * @param bounds_min Minimum corner of the bounding box
+ * @param bounds_max Maximum corner of the bounding box
+ * @return glm::vec3 The size of the box along each axis
+*/
+glm::vec3 quantization_extent(glm::vec3 bounds_min, glm::vec3 bounds_max);
+/**
+ * @brief Pack a unit vector as GL_INT_2_10_10_10_REV (signed normalized)
+ *
+ * @param normal The vector to pack, components are clamped to [-1,1]
+ * @return uint32_t The packed vector, w is set to 0
+*/
+uint32_t pack_normal(glm::vec3 normal);
+/**
+ * @brief Convert a 32 bit float to a 16 bit (half precision) float
+ *
+ * Rounds to nearest even, values too large become infinity and values too small
+ * become (signed) zero or denormals.
+ *
+ * @param value The value to convert
+ * @return uint16_t The bits of the half precision float
+*/
+uint16_t float_to_half(float value);
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,216 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the sub-allocator of large OpenGL buffers
+ *
+ * @file Buffer-Heap.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Buffer-Heap.hpp"
+#include "GL-State.hpp"
+
+using namespace std;
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                Offset Allocator Class                                *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Offset_Allocator::Offset_Allocator(size_t size)
+{
+    capacity = size;
+    used = 0;
+    allocations = 0;
+    if(size > 0)
+        insert_free(0, size);
+}
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+Heap_Stats Offset_Allocator::getStats()
+{
+    Heap_Stats stats = {};
+    stats.capacity = capacity;
+    stats.used = used;
+    stats.free = capacity - used;
+    stats.largest_free = free_by_size.empty()? 0 : free_by_size.rbegin()->first;
+    stats.free_ranges = free_by_offset.size();
+    stats.allocations = allocations;
+    stats.fragmentation = stats.free==0? 0 : 1.f - float(stats.largest_free)/stats.free;
+    return stats;
+}
+
+//──── Allocation ────────────────────────────────────────────────────────────────────────
+
+bool Offset_Allocator::allocate(size_t size, size_t alignment, size_t &offset)
+{
+    if(size == 0 || alignment == 0)
+        return false;
+    //Smallest free range that still fits once its start is aligned
+    auto candidate = free_by_size.lower_bound(size);
+    for(; candidate != free_by_size.end(); ++candidate)
+    {
+        size_t start = candidate->second;
+        size_t aligned = (start + alignment - 1)/alignment*alignment;
+        if(aligned + size <= start + candidate->first)
+            break;
+    }
+    if(candidate == free_by_size.end())
+        return false;
+
+    size_t start = candidate->second;
+    size_t end = start + candidate->first;
+    offset = (start + alignment - 1)/alignment*alignment;
+    erase_free(free_by_offset.find(start));
+    //The padding before the aligned offset and the tail stay free
+    if(offset > start)
+        insert_free(start, offset - start);
+    if(offset + size < end)
+        insert_free(offset + size, end - offset - size);
+
+    used += size;
+    allocations++;
+    return true;
+}
+
+void Offset_Allocator::release(size_t offset, size_t size)
+{
+    used -= size;
+    allocations--;
+    //Merge with the free ranges that touch the released one
+    auto next = free_by_offset.lower_bound(offset);
+    if(next != free_by_offset.end() && next->first == offset + size)
+    {
+        size += next->second;
+        erase_free(next);
+    }
+    auto previous = free_by_offset.lower_bound(offset);
+    if(previous != free_by_offset.begin())
+    {
+        --previous;
+        if(previous->first + previous->second == offset)
+        {
+            offset = previous->first;
+            size += previous->second;
+            erase_free(previous);
+        }
+    }
+    insert_free(offset, size);
+}
+
+void Offset_Allocator::insert_free(size_t offset, size_t size)
+{
+    free_by_offset[offset] = size;
+    free_by_size.insert({size, offset});
+}
+
+void Offset_Allocator::erase_free(map<size_t, size_t>::iterator range)
+{
+    auto same_size = free_by_size.equal_range(range->second);
+    for(auto entry = same_size.first; entry != same_size.second; ++entry)
+    {
+        if(entry->second == range->first)
+        {
+            free_by_size.erase(entry);
+            break;
+        }
+    }
+    free_by_offset.erase(range);
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Buffer Heap Class                                  *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Buffer_Heap::Buffer_Heap(size_t capacity, string label) : allocator(capacity)
+{
+    glGenBuffers(1, &buffer);
+    GL_State::current().bind_buffer(GL_ARRAY_BUFFER, buffer);
+    glObjectLabel(GL_BUFFER, buffer, -1, label.c_str());
+    glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STATIC_DRAW);
+}
+
+Buffer_Heap::~Buffer_Heap()
+{
+    for(Pending_Release &range : pending)
+        glDeleteSync(range.fence);
+    GL_State::delete_buffers(1, &buffer);
+}
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+Heap_Stats Buffer_Heap::getStats()
+{
+    lock_guard<mutex> lock(heap_mutex);
+    Heap_Stats stats = allocator.getStats();
+    //Ranges waiting on the GPU are not allocated anymore but cannot be used yet
+    for(Pending_Release &range : pending)
+    {
+        stats.used -= range.size;
+        stats.free += range.size;
+        stats.allocations--;
+    }
+    stats.fragmentation = stats.free==0? 0 :
+        1.f - float(stats.largest_free)/stats.free;
+    return stats;
+}
+
+//──── Allocation ────────────────────────────────────────────────────────────────────────
+
+bool Buffer_Heap::allocate(size_t size, size_t alignment, size_t &offset)
+{
+    lock_guard<mutex> lock(heap_mutex);
+    reclaim();
+    return allocator.allocate(size, alignment, offset);
+}
+
+void Buffer_Heap::release(size_t offset, size_t size)
+{
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    //Make sure the fence reaches the GPU so other contexts can wait on it
+    glFlush();
+    lock_guard<mutex> lock(heap_mutex);
+    pending.push_back({offset, size, fence});
+}
+
+void Buffer_Heap::upload(size_t offset, const void *data, size_t size)
+{
+    GL_State::current().bind_buffer(GL_ARRAY_BUFFER, buffer);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+}
+
+void Buffer_Heap::reclaim()
+{
+    //Fences signal in order, stop at the first one that is still pending
+    while(!pending.empty())
+    {
+        GLenum status = glClientWaitSync(pending.front().fence, 0, 0);
+        if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        glDeleteSync(pending.front().fence);
+        allocator.release(pending.front().offset, pending.front().size);
+        pending.pop_front();
+    }
+}
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,227 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the sub-allocator of large OpenGL buffers
+ *
+ * @file Buffer-Heap.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+
+#include <map>
+#include <deque>
+#include <mutex>
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Occupancy of a heap
+ *
+*/
+struct Heap_Stats
+{
+    size_t capacity;        //!< Size in bytes of the heap
+    size_t used;            //!< Bytes handed out, including alignment padding
+    size_t free;            //!< Bytes available, including ranges waiting on the GPU
+    size_t largest_free;    //!< Size of the largest free range
+    uint free_ranges;       //!< Number of separate free ranges
+    uint allocations;       //!< Number of live allocations
+    /**
+     * @brief Fraction of the free memory outside the largest free range
+     *
+     * 0 when all free memory is contiguous, close to 1 when it is scattered in small
+     * ranges that cannot hold a large allocation.
+    */
+    float fragmentation;
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Hands out ranges of a fixed size address space
+ *
+ * Free ranges are kept both by offset, to merge a released range with its neighbours,
+ * and by size, to pick the smallest range that fits a request (best fit). Every
+ * operation is logarithmic in the number of free ranges. The allocator only does the
+ * bookkeeping, it does not own any memory.
+*/
+class Offset_Allocator
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        size_t capacity;    //!< Size of the address space
+        size_t used;        //!< Bytes currently allocated
+        uint allocations;   //!< Number of live allocations
+        std::map<size_t, size_t> free_by_offset;        //!< Offset to size of free ranges
+        std::multimap<size_t, size_t> free_by_size;     //!< Size to offset of free ranges
+
+        /**
+         * @brief Add a free range to both indices
+         *
+        */
+        void insert_free(size_t offset, size_t size);
+        /**
+         * @brief Remove a free range from both indices
+         *
+        */
+        void erase_free(std::map<size_t, size_t>::iterator range);
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Construct an allocator with its whole space free
+         *
+         * @param size Size of the address space
+        */
+        Offset_Allocator(size_t size);
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the occupancy of the address space
+         *
+        */
+        Heap_Stats getStats();
+
+//──── Allocation ────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Reserve a range
+         *
+         * @param size Size of the range
+         * @param alignment The offset will be a multiple of it, need not be a power of 2
+         * @param offset Where to store the offset of the range
+         * @return true If the range was reserved
+         * @return false If no free range can hold the request
+        */
+        bool allocate(size_t size, size_t alignment, size_t &offset);
+        /**
+         * @brief Return a range to the free space
+         *
+         * @param offset Offset returned by allocate()
+         * @param size Size given to allocate()
+        */
+        void release(size_t offset, size_t size);
+};
+/**
+ * @brief A large OpenGL buffer whose ranges are handed out with an Offset_Allocator
+ *
+ * Released ranges may still be read by draws in flight, they are only reused after a
+ * fence inserted at the time of the release has signaled. The heap is thread safe: a
+ * range can be allocated and filled on a loading context and released on the
+ * rendering one, as long as both share objects.
+*/
+class Buffer_Heap
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief A released range waiting for the GPU to stop using it
+         *
+        */
+        struct Pending_Release
+        {
+            size_t offset;  //!< Start of the range
+            size_t size;    //!< Size of the range
+            GLsync fence;   //!< Signals once the commands before the release are done
+        };
+
+        GLuint buffer;                      //!< The OpenGL buffer
+        Offset_Allocator allocator;         //!< Bookkeeping of the ranges of the buffer
+        std::deque<Pending_Release> pending;//!< Released ranges, oldest first
+        std::mutex heap_mutex;              //!< Guards the allocator and pending
+
+        /**
+         * @brief Return the released ranges the GPU is done with to the allocator
+         *
+        */
+        void reclaim();
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create the buffer
+         *
+         * @param capacity Size in bytes of the buffer
+         * @param label OpenGL label of the buffer
+        */
+        Buffer_Heap(size_t capacity, std::string label);
+        /**
+         * @brief Delete the buffer
+         *
+        */
+        ~Buffer_Heap();
+
+        Buffer_Heap(const Buffer_Heap&) = delete;
+        Buffer_Heap &operator=(const Buffer_Heap&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the OpenGL name of the buffer
+         *
+        */
+        GLuint inline getBuffer(){return buffer;}
+        /**
+         * @brief Get the occupancy of the buffer
+         *
+        */
+        Heap_Stats getStats();
+
+//──── Allocation ────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Reserve a range of the buffer
+         *
+         * @param size Size in bytes of the range
+         * @param alignment The offset will be a multiple of it
+         * @param offset Where to store the offset in bytes of the range
+         * @return true If the range was reserved
+         * @return false If the buffer has no free range large enough
+        */
+        bool allocate(size_t size, size_t alignment, size_t &offset);
+        /**
+         * @brief Release a range once the commands issued so far are complete
+         *
+         * Must be called on a thread with a current context.
+         *
+         * @param offset Offset returned by allocate()
+         * @param size Size given to allocate()
+        */
+        void release(size_t offset, size_t size);
+        /**
+         * @brief Copy data into the buffer
+         *
+         * @param offset Offset in bytes at which to write
+         * @param data Data to copy
+         * @param size Size in bytes of the data
+        */
+        void upload(size_t offset, const void *data, size_t size);
+};
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,164 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the multi draw indirect batch renderer
+ *
+ * @file Draw-Batch.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Draw-Batch.hpp"
+#include "Quantization.hpp"
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Draw Batch Class                                  *
+ *                                                                                      */
+//========================================================================================
+namespace Helios{
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Draw_Batch::Draw_Batch()
+{
+    call_count = 0;
+    glGenBuffers(1, &command_buffer);
+    GL_State::current().bind_buffer(GL_DRAW_INDIRECT_BUFFER, command_buffer);
+    glObjectLabel(GL_BUFFER, command_buffer, -1, "\"Batch command buffer\"");
+    glGenBuffers(1, &draw_buffer);
+    GL_State::current().bind_buffer(GL_SHADER_STORAGE_BUFFER, draw_buffer);
+    glObjectLabel(GL_BUFFER, draw_buffer, -1, "\"Batch draw buffer\"");
+
+    //Shaders reach the data of their draw through gl_BaseInstanceARB
+    if(!GLEW_ARB_shader_draw_parameters)
+    {
+        cerr << "GL_ARB_shader_draw_parameters is not supported, batched draws " <<
+            "cannot find their model matrices" << endl;
+        Log::record_log(
+            string(80, '!') +
+            "\nGL_ARB_shader_draw_parameters is not supported\n" +
+            string(80, '!')
+            );
+    }
+}
+
+Draw_Batch::~Draw_Batch()
+{
+    GL_State::delete_buffers(1, &command_buffer);
+    GL_State::delete_buffers(1, &draw_buffer);
+}
+
+//──── Drawing ───────────────────────────────────────────────────────────────────────────
+
+bool Draw_Batch::add(Mesh &mesh, const mat4 &model, uint lod)
+{
+    Draw_Elements_Command command;
+    Batch_Draw draw;
+    if(!make_draw(mesh, model, lod, command, draw))
+        return false;
+    command.base_instance = draws.size();
+
+    commands.push_back({command, &mesh, mesh.VAO, mesh.index_type, lod, mesh.revision});
+    draws.push_back(draw);
+    return true;
+}
+
+bool Draw_Batch::make_draw(Mesh &mesh, const mat4 &model, uint lod,
+    Draw_Elements_Command &command, Batch_Draw &draw)
+{
+    if(!mesh.make_resident())
+        return false;
+    lod = std::min<uint>(lod, mesh.lods.size()-1);
+
+    //Non quantized positions are used as they are
+    draw = {model, vec4(1), vec4(0)};
+    if(mesh.flags & HELIOS_MESH_QUANTIZED)
+    {
+        draw.position_scale = vec4(quantization_extent(mesh.bounds_min, mesh.bounds_max), 0);
+        draw.position_offset = vec4(mesh.bounds_min, 0);
+    }
+
+    GLuint index_size = mesh.index_type==GL_UNSIGNED_SHORT? sizeof(GLushort) : sizeof(GLuint);
+    command.count = mesh.lods[lod].index_count;
+    command.instance_count = 1;
+    command.first_index = mesh.index_start/index_size + mesh.lods[lod].first_index;
+    command.base_vertex = mesh.base_vertex;
+    command.base_instance = 0;
+    return true;
+}
+
+void Draw_Batch::submit()
+{
+    call_count = 0;
+    if(commands.empty())
+        return;
+
+    //Levels of detail that arrived after a draw was added may have moved its mesh
+    for(Batch_Command &entry : commands)
+    {
+        Mesh &mesh = *entry.mesh;
+        mesh.make_resident();
+        if(entry.revision == mesh.revision)
+            continue;
+        GLuint instance = entry.command.base_instance;
+        make_draw(mesh, draws[instance].model, entry.lod, entry.command, draws[instance]);
+        entry.command.base_instance = instance;
+        entry = {entry.command, &mesh, mesh.VAO, mesh.index_type, entry.lod,
+            mesh.revision};
+    }
+
+    //Draws reading the same buffers become consecutive, the base instance of every
+    //command still points to its own data
+    stable_sort(commands.begin(), commands.end(),
+        [](const Batch_Command &a, const Batch_Command &b)
+        {return a.VAO < b.VAO || (a.VAO == b.VAO && a.index_type < b.index_type);});
+    vector<Draw_Elements_Command> packed(commands.size());
+    for(uint i=0; i<commands.size(); i++)
+        packed[i] = commands[i].command;
+
+    //Orphan the buffers of the previous submission instead of waiting for it
+    GL_State &state = GL_State::current();
+    state.bind_buffer(GL_DRAW_INDIRECT_BUFFER, command_buffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, packed.size()*sizeof(Draw_Elements_Command),
+        packed.data(), GL_STREAM_DRAW);
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, draw_buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, draws.size()*sizeof(Batch_Draw), draws.data(),
+        GL_STREAM_DRAW);
+    state.bind_buffer_base(GL_SHADER_STORAGE_BUFFER, HELIOS_BATCH_DRAW_BINDING,
+        draw_buffer);
+
+    for(uint first=0; first<commands.size();)
+    {
+        uint last = first + 1;
+        while(last<commands.size() && commands[last].VAO == commands[first].VAO &&
+            commands[last].index_type == commands[first].index_type)
+            last++;
+
+        //The indirect buffer binding is global state, it survives VAO changes
+        commands[first].mesh->bind_vertex_buffers();
+        glMultiDrawElementsIndirect(GL_TRIANGLES, commands[first].index_type,
+            (void*)(first*sizeof(Draw_Elements_Command)), last - first, 0);
+        call_count++;
+        first = last;
+    }
+}
+
+void Draw_Batch::clear()
+{
+    commands.clear();
+    draws.clear();
+}
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,178 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the multi draw indirect batch renderer
+ *
+ * @file Draw-Batch.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+//########################################################################################
+
+/**
+ * @brief Shader storage binding point of the per draw data of a Draw_Batch
+ *
+*/
+#define HELIOS_BATCH_DRAW_BINDING 0
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Layout of a command read by glMultiDrawElementsIndirect
+ *
+*/
+struct Draw_Elements_Command
+{
+    GLuint count;           //!< Number of indices to draw
+    GLuint instance_count;  //!< Number of instances to draw
+    GLuint first_index;     //!< Offset in indices in the element buffer
+    GLint base_vertex;      //!< Added to every index
+    GLuint base_instance;   //!< First instance, used to find the data of the draw
+};
+/**
+ * @brief Data of one draw of a batch, as laid out in the std430 storage buffer
+ *
+*/
+struct Batch_Draw
+{
+    glm::mat4 model;            //!< Model matrix of the draw
+    glm::vec4 position_scale;   //!< Dequantization scale of the positions (w unused)
+    glm::vec4 position_offset;  //!< Dequantization offset of the positions (w unused)
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Collects the draws of many meshes and submits them with few GL calls
+ *
+ * Every added draw becomes a Draw_Elements_Command whose base instance is the index of
+ * its Batch_Draw in a storage buffer bound to HELIOS_BATCH_DRAW_BINDING, so shaders
+ * read their model matrix through gl_BaseInstanceARB (see Batch-Vertex.glsl). At
+ * submission, draws that share a VAO and index type are issued together with a single
+ * glMultiDrawElementsIndirect call. Meshes imported with HELIOS_MESH_SHARED_BUFFERS
+ * share the VAO of their page, so a whole scene of them takes one call per page.
+ *
+ * @code
+ * batch.clear();
+ * for(Object &object : scene)
+ *     batch.add(*object.mesh, object.model);
+ * program->use();
+ * batch.submit();
+ * @endcode
+ *
+ * The meshes must stay alive until the batch is submitted.
+*/
+class Draw_Batch
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief A draw command and what it needs to be bound
+         *
+        */
+        struct Batch_Command
+        {
+            Draw_Elements_Command command;  //!< The indirect command
+            Mesh *mesh;                     //!< Mesh drawn by the command
+            GLuint VAO;                     //!< VAO of the mesh
+            GLenum index_type;              //!< Type of the indices of the mesh
+            uint lod;                       //!< Level of detail asked for
+            uint revision;                  //!< Revision of the mesh the command matches
+        };
+
+        GLuint command_buffer;                  //!< GL_DRAW_INDIRECT_BUFFER of commands
+        GLuint draw_buffer;                     //!< Storage buffer of the Batch_Draw
+        std::vector<Batch_Command> commands;    //!< Commands added since the last clear
+        std::vector<Batch_Draw> draws;          //!< Data of every draw added
+        uint call_count;                        //!< GL draw calls of the last submit
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create the buffers of the batch
+         *
+        */
+        Draw_Batch();
+        /**
+         * @brief Delete the buffers of the batch
+         *
+        */
+        ~Draw_Batch();
+
+        Draw_Batch(const Draw_Batch&) = delete;
+        Draw_Batch &operator=(const Draw_Batch&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of draws added since the last clear
+         *
+        */
+        uint inline getDrawCount(){return commands.size();}
+        /**
+         * @brief Get the number of glMultiDrawElementsIndirect calls of the last submit
+         *
+        */
+        uint inline getCallCount(){return call_count;}
+
+//──── Drawing ───────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Add a draw of a mesh to the batch
+         *
+         * @param mesh The mesh to draw
+         * @param model Model matrix of the draw
+         * @param lod Level of detail to draw (see Mesh::select_lod())
+         * @return true If the draw was added
+         * @return false If the mesh is not resident yet
+        */
+        bool add(Mesh &mesh, const glm::mat4 &model, uint lod = 0);
+        /**
+         * @brief Upload the draws and issue them with the current program
+         *
+         * The batch keeps its draws, it can be submitted again (e.g for another pass).
+        */
+        void submit();
+        /**
+         * @brief Remove every draw from the batch
+         *
+        */
+        void clear();
+        /**
+         * @brief Describe a draw of a mesh, with a base instance of 0
+         *
+         * @param mesh The mesh to draw
+         * @param model Model matrix of the draw
+         * @param lod Level of detail to draw, clamped to the levels of the mesh
+         * @param command Where to store the indirect command of the draw
+         * @param draw Where to store the per draw data read by the shaders
+         * @return true If the draw was described
+         * @return false If the mesh is not resident yet
+        */
+        static bool make_draw(Mesh &mesh, const glm::mat4 &model, uint lod,
+            Draw_Elements_Command &command, Batch_Draw &draw);
+};
+
+}//Close Helios namespace
+//########################################################################################
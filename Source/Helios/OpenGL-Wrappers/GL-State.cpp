@@ -0,0 +1,463 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the shadow copy of the OpenGL state
+ *
+ * @file GL-State.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "GL-State.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+
+using namespace std;
+//########################################################################################
+
+/**
+ * @brief Value of state that was never set through the cache
+ *
+*/
+#define UNKNOWN_STATE GLuint(-1)
+/**
+ * @brief Index of the non indexed binding of a buffer target
+ *
+*/
+#define GENERIC_BINDING GLuint(-1)
+/**
+ * @brief Deletions a context queues before it forgets every binding instead
+ *
+*/
+#define MAX_PENDING_DELETIONS 1024
+
+namespace Helios{
+
+/**
+ * @brief State of every context, std::map keeps references valid across insertions
+ *
+*/
+static map<GLFWwindow*, GL_State> context_states;
+static mutex context_mutex;
+
+//========================================================================================
+/*                                                                                      *
+ *                                    GL_State Class                                    *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+GL_State::GL_State() : has_deleted(false)
+{
+    issued = skipped = 0;
+    last_issued = last_skipped = 0;
+    invalidate();
+}
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+GL_State &GL_State::current()
+{
+    //A thread only looks the map up when its current context changes
+    thread_local GLFWwindow *cached_context = NULL;
+    thread_local GL_State *cached_state = NULL;
+
+    GLFWwindow *context = glfwGetCurrentContext();
+    if(context != cached_context || cached_state == NULL)
+    {
+        lock_guard<mutex> lock(context_mutex);
+        cached_state = &context_states[context];
+        cached_context = context;
+    }
+    //Apply the objects deleted from other contexts since the last call
+    if(cached_state->has_deleted)
+    {
+        vector<pair<GLenum, GLuint>> deleted;
+        {
+            lock_guard<mutex> lock(context_mutex);
+            deleted.swap(cached_state->deleted);
+            cached_state->has_deleted = false;
+        }
+        for(pair<GLenum, GLuint> &object : deleted)
+            cached_state->forget_object(object.first, object.second);
+    }
+    return *cached_state;
+}
+
+//──── Private Methods ───────────────────────────────────────────────────────────────────
+
+void GL_State::forget_bindings()
+{
+    program = UNKNOWN_STATE;
+    vertex_array = UNKNOWN_STATE;
+    buffers.clear();
+    textures.clear();
+    images.clear();
+    vertex_buffers.clear();
+}
+
+GLuint &GL_State::buffer_slot(GLenum target, GLuint index)
+{
+    for(Buffer_Binding &binding : buffers)
+        if(binding.target == target && binding.index == index)
+            return binding.buffer;
+    buffers.push_back({target, index, UNKNOWN_STATE});
+    return buffers.back().buffer;
+}
+
+void GL_State::forget_object(GLenum kind, GLuint name)
+{
+    if(kind == GL_NONE)
+    {
+        forget_bindings();
+        return;
+    }
+    if(kind == GL_PROGRAM && program == name)
+        program = UNKNOWN_STATE;
+    if(kind == GL_VERTEX_ARRAY && vertex_array == name)
+        vertex_array = UNKNOWN_STATE;
+    if(kind == GL_BUFFER)
+    {
+        for(Buffer_Binding &binding : buffers)
+            if(binding.buffer == name)
+                binding.buffer = UNKNOWN_STATE;
+    }
+    if(kind == GL_TEXTURE)
+    {
+        for(Texture_Binding &binding : textures)
+            if(binding.texture == name)
+                binding.texture = UNKNOWN_STATE;
+        for(uint i = 0; i < images.size();)
+        {
+            if(images[i].texture == name)
+                images.erase(images.begin() + i);
+            else
+                i++;
+        }
+    }
+    //Vertex buffers are keyed by VAO, a deleted buffer may be attached to any of them
+    if(kind == GL_BUFFER || kind == GL_VERTEX_ARRAY)
+    {
+        for(auto binding = vertex_buffers.begin(); binding != vertex_buffers.end();)
+        {
+            bool attached = kind == GL_BUFFER? binding->second.buffer == name :
+                GLuint(binding->first >> 32) == name;
+            if(attached)
+                binding = vertex_buffers.erase(binding);
+            else
+                binding++;
+        }
+    }
+}
+
+void GL_State::forget_deleted(GLenum kind, GLsizei count, const GLuint *names)
+{
+    GLFWwindow *context = glfwGetCurrentContext();
+    lock_guard<mutex> lock(context_mutex);
+    for(auto &entry : context_states)
+    {
+        GL_State &state = entry.second;
+        //Each thread only touches the state of its own context
+        if(entry.first == context)
+        {
+            for(GLsizei i = 0; i < count; i++)
+                state.forget_object(kind, names[i]);
+            continue;
+        }
+        if(kind == GL_VERTEX_ARRAY)
+            continue;
+        if(state.deleted.size() + count > MAX_PENDING_DELETIONS)
+            state.deleted.assign(1, {GL_NONE, 0});
+        else if(state.deleted.empty() || state.deleted.front().first != GL_NONE)
+            for(GLsizei i = 0; i < count; i++)
+                state.deleted.push_back({kind, names[i]});
+        state.has_deleted = true;
+    }
+}
+
+//──── Bindings ──────────────────────────────────────────────────────────────────────────
+
+void GL_State::use_program(GLuint program_id)
+{
+    if(program == program_id)
+    {
+        skipped++;
+        return;
+    }
+    glUseProgram(program_id);
+    program = program_id;
+    issued++;
+}
+
+void GL_State::bind_vertex_array(GLuint array)
+{
+    if(vertex_array == array)
+    {
+        skipped++;
+        return;
+    }
+    glBindVertexArray(array);
+    vertex_array = array;
+    issued++;
+}
+
+void GL_State::bind_buffer(GLenum target, GLuint buffer)
+{
+    //The element array binding changes with the VAO, it is not tracked
+    if(target == GL_ELEMENT_ARRAY_BUFFER)
+    {
+        glBindBuffer(target, buffer);
+        issued++;
+        return;
+    }
+    GLuint &slot = buffer_slot(target, GENERIC_BINDING);
+    if(slot == buffer)
+    {
+        skipped++;
+        return;
+    }
+    glBindBuffer(target, buffer);
+    slot = buffer;
+    issued++;
+}
+
+void GL_State::bind_buffer_base(GLenum target, GLuint index, GLuint buffer)
+{
+    GLuint &slot = buffer_slot(target, index);
+    if(slot == buffer)
+    {
+        skipped++;
+        return;
+    }
+    glBindBufferBase(target, index, buffer);
+    slot = buffer;
+    buffer_slot(target, GENERIC_BINDING) = buffer;
+    issued++;
+}
+
+void GL_State::bind_vertex_buffer(GLuint index, GLuint buffer, GLintptr offset,
+    GLsizei stride)
+{
+    if(vertex_array == UNKNOWN_STATE)
+    {
+        glBindVertexBuffer(index, buffer, offset, stride);
+        issued++;
+        return;
+    }
+    uint64_t key = (uint64_t(vertex_array) << 32) | index;
+    auto binding = vertex_buffers.find(key);
+    if(binding != vertex_buffers.end() && binding->second.buffer == buffer &&
+        binding->second.offset == offset && binding->second.stride == stride)
+    {
+        skipped++;
+        return;
+    }
+    glBindVertexBuffer(index, buffer, offset, stride);
+    vertex_buffers[key] = {buffer, offset, stride};
+    issued++;
+}
+
+void GL_State::bind_texture(GLenum target, GLuint texture, GLint unit)
+{
+    if(unit < 0 && active_unit == UNKNOWN_STATE)
+    {
+        //Nothing is known about the active unit, bind blindly
+        glBindTexture(target, texture);
+        issued++;
+        return;
+    }
+    GLuint texture_unit = unit < 0? active_unit : GLuint(unit);
+    Texture_Binding *slot = NULL;
+    for(Texture_Binding &binding : textures)
+        if(binding.unit == texture_unit && binding.target == target)
+            slot = &binding;
+    if(slot != NULL && slot->texture == texture)
+    {
+        skipped++;
+        return;
+    }
+
+    if(active_unit != texture_unit)
+    {
+        glActiveTexture(GL_TEXTURE0 + texture_unit);
+        active_unit = texture_unit;
+        issued++;
+    }
+    glBindTexture(target, texture);
+    if(slot == NULL)
+        textures.push_back({texture_unit, target, texture});
+    else
+        slot->texture = texture;
+    issued++;
+}
+
+void GL_State::bind_image_texture(GLuint unit, GLuint texture, GLint level,
+    GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+    Image_Binding binding = {unit, texture, level, layered, layer, access, format};
+    Image_Binding *slot = NULL;
+    for(Image_Binding &image : images)
+        if(image.unit == unit)
+            slot = &image;
+    if(slot != NULL && slot->texture == texture && slot->level == level &&
+        slot->layered == layered && slot->layer == layer && slot->access == access &&
+        slot->format == format)
+    {
+        skipped++;
+        return;
+    }
+    glBindImageTexture(unit, texture, level, layered, layer, access, format);
+    if(slot == NULL)
+        images.push_back(binding);
+    else
+        *slot = binding;
+    issued++;
+}
+
+GLuint GL_State::getBufferBinding(GLenum target, GLuint index)
+{
+    GLuint &slot = buffer_slot(target, index);
+    if(slot != UNKNOWN_STATE)
+        return slot;
+
+    GLenum query = GL_SHADER_STORAGE_BUFFER_BINDING;
+    if(target == GL_UNIFORM_BUFFER)
+        query = GL_UNIFORM_BUFFER_BINDING;
+    else if(target == GL_ATOMIC_COUNTER_BUFFER)
+        query = GL_ATOMIC_COUNTER_BUFFER_BINDING;
+    else if(target == GL_TRANSFORM_FEEDBACK_BUFFER)
+        query = GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+    GLint buffer;
+    glGetIntegeri_v(query, index, &buffer);
+    slot = buffer;
+    return slot;
+}
+
+GLuint GL_State::getImageBinding(GLuint unit)
+{
+    for(Image_Binding &image : images)
+        if(image.unit == unit)
+            return image.texture;
+
+    //Only the texture is known, the next bind of the unit always reaches the driver
+    GLint texture;
+    glGetIntegeri_v(GL_IMAGE_BINDING_NAME, unit, &texture);
+    images.push_back({unit, GLuint(texture), -1, GL_FALSE, 0, GL_NONE, GL_NONE});
+    return texture;
+}
+
+//──── Fixed Function State ──────────────────────────────────────────────────────────────
+
+void GL_State::set_capability(GLenum capability, bool enabled)
+{
+    for(pair<GLenum, bool> &known : capabilities)
+    {
+        if(known.first != capability)
+            continue;
+        if(known.second == enabled)
+        {
+            skipped++;
+            return;
+        }
+        known.second = enabled;
+        enabled? glEnable(capability) : glDisable(capability);
+        issued++;
+        return;
+    }
+    capabilities.push_back({capability, enabled});
+    enabled? glEnable(capability) : glDisable(capability);
+    issued++;
+}
+
+void GL_State::depth_func(GLenum function)
+{
+    if(depth_function == function)
+    {
+        skipped++;
+        return;
+    }
+    glDepthFunc(function);
+    depth_function = function;
+    issued++;
+}
+
+void GL_State::cull_face(GLenum mode)
+{
+    if(cull_mode == mode)
+    {
+        skipped++;
+        return;
+    }
+    glCullFace(mode);
+    cull_mode = mode;
+    issued++;
+}
+
+void GL_State::blend_func(GLenum source, GLenum destination)
+{
+    if(blend_source == source && blend_destination == destination)
+    {
+        skipped++;
+        return;
+    }
+    glBlendFunc(source, destination);
+    blend_source = source;
+    blend_destination = destination;
+    issued++;
+}
+
+//──── Bookkeeping ───────────────────────────────────────────────────────────────────────
+
+void GL_State::invalidate()
+{
+    forget_bindings();
+    active_unit = UNKNOWN_STATE;
+    depth_function = UNKNOWN_STATE;
+    cull_mode = UNKNOWN_STATE;
+    blend_source = blend_destination = UNKNOWN_STATE;
+    capabilities.clear();
+}
+
+void GL_State::delete_buffers(GLsizei count, const GLuint *buffers)
+{
+    glDeleteBuffers(count, buffers);
+    forget_deleted(GL_BUFFER, count, buffers);
+}
+
+void GL_State::delete_textures(GLsizei count, const GLuint *textures)
+{
+    glDeleteTextures(count, textures);
+    forget_deleted(GL_TEXTURE, count, textures);
+}
+
+void GL_State::delete_vertex_arrays(GLsizei count, const GLuint *arrays)
+{
+    glDeleteVertexArrays(count, arrays);
+    forget_deleted(GL_VERTEX_ARRAY, count, arrays);
+}
+
+void GL_State::delete_program(GLuint program_id)
+{
+    glDeleteProgram(program_id);
+    forget_deleted(GL_PROGRAM, 1, &program_id);
+}
+
+void GL_State::end_frame()
+{
+    last_issued = issued;
+    last_skipped = skipped;
+    issued = skipped = 0;
+}
+//########################################################################################
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,307 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the shadow copy of the OpenGL state
+ *
+ * @file GL-State.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+
+#include <atomic>
+#include <unordered_map>
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Shadow copy of the binding and capability state of an OpenGL context
+ *
+ * The Helios wrappers bind objects and toggle capabilities through the state of the
+ * current context, which skips the OpenGL calls that would not change anything. State
+ * that was never set through it is unknown, the first call always reaches the driver.
+ *
+ * @code
+ * GL_State &state = GL_State::current();
+ * state.enable(GL_DEPTH_TEST);
+ * state.use_program(program->getProgramID());
+ * ...
+ * state.end_frame();
+ * cout << state.getSkippedCalls() << " redundant calls skipped" << endl;
+ * @endcode
+ *
+ * Code that changes the same state with raw OpenGL calls must call invalidate()
+ * afterwards. Deleting a buffer, texture, vertex array or program unbinds it and frees
+ * its name for reuse, so objects are deleted through delete_buffers(),
+ * delete_textures(), delete_vertex_arrays() and delete_program(). Only the bindings of
+ * the deleted names are forgotten, other contexts forget them the next time their
+ * state is requested.
+*/
+class GL_State
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief A buffer bound to a target, or to an indexed binding point of it
+         *
+        */
+        struct Buffer_Binding
+        {
+            GLenum target;  //!< Buffer target (e.g GL_SHADER_STORAGE_BUFFER)
+            GLuint index;   //!< Binding point, ~0 for the target itself
+            GLuint buffer;  //!< Bound buffer
+        };
+        /**
+         * @brief A texture bound to a target of a texture unit
+         *
+        */
+        struct Texture_Binding
+        {
+            GLuint unit;    //!< Texture unit
+            GLenum target;  //!< Texture target (e.g GL_TEXTURE_2D)
+            GLuint texture; //!< Bound texture
+        };
+        /**
+         * @brief A level of a texture bound to an image unit
+         *
+        */
+        struct Image_Binding
+        {
+            GLuint unit;        //!< Image unit
+            GLuint texture;     //!< Bound texture
+            GLint level;        //!< Bound mipmap level
+            GLboolean layered;  //!< Whether every layer is bound
+            GLint layer;        //!< Bound layer if not layered
+            GLenum access;      //!< GL_READ_ONLY, GL_WRITE_ONLY or GL_READ_WRITE
+            GLenum format;      //!< Format the shaders see (e.g GL_R32F)
+        };
+        /**
+         * @brief A buffer attached to a vertex buffer binding point of a VAO
+         *
+        */
+        struct Vertex_Binding
+        {
+            GLuint buffer;      //!< Attached buffer
+            GLintptr offset;    //!< Offset of the first vertex
+            GLsizei stride;     //!< Distance between vertices
+        };
+
+        GLuint program;         //!< Current program
+        GLuint vertex_array;    //!< Bound VAO
+        GLuint active_unit;     //!< Active texture unit
+        GLenum depth_function;  //!< Depth comparison
+        GLenum cull_mode;       //!< Faces culled
+        GLenum blend_source;    //!< Source blend factor
+        GLenum blend_destination;   //!< Destination blend factor
+
+        std::vector<Buffer_Binding> buffers;                //!< Bound buffers
+        std::vector<Texture_Binding> textures;              //!< Bound textures
+        std::vector<Image_Binding> images;                  //!< Bound image units
+        std::vector<std::pair<GLenum, bool>> capabilities;  //!< Known capabilities
+        //! Vertex buffers of every VAO, keyed by VAO and binding point
+        std::unordered_map<uint64_t, Vertex_Binding> vertex_buffers;
+
+        //! Kind and name of objects deleted from other contexts, GL_NONE forgets all
+        std::vector<std::pair<GLenum, GLuint>> deleted;
+        std::atomic<bool> has_deleted;  //!< Whether deleted holds anything
+        uint issued;            //!< Calls made this frame
+        uint skipped;           //!< Calls skipped this frame
+        uint last_issued;       //!< Calls made last frame
+        uint last_skipped;      //!< Calls skipped last frame
+
+        /**
+         * @brief Forget which objects are bound, capabilities are kept
+         *
+        */
+        void forget_bindings();
+        /**
+         * @brief Find the buffer bound to a binding point
+         *
+         * @return GLuint& The binding, unknown if it was never set
+        */
+        GLuint &buffer_slot(GLenum target, GLuint index);
+        /**
+         * @brief Forget the bindings of a deleted object
+         *
+         * @param kind GL_BUFFER, GL_TEXTURE, GL_VERTEX_ARRAY or GL_PROGRAM
+         * @param name The deleted object
+        */
+        void forget_object(GLenum kind, GLuint name);
+        /**
+         * @brief Forget deleted objects in the current context and queue them for the
+         * other contexts, which share every object kind but vertex arrays
+         *
+        */
+        static void forget_deleted(GLenum kind, GLsizei count, const GLuint *names);
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create a state where everything is unknown
+         *
+        */
+        GL_State();
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the state of the context current on the calling thread
+         *
+        */
+        static GL_State &current();
+        /**
+         * @brief Get the number of calls that reached the driver during the last frame
+         *
+        */
+        uint inline getIssuedCalls(){return last_issued;}
+        /**
+         * @brief Get the number of redundant calls skipped during the last frame
+         *
+        */
+        uint inline getSkippedCalls(){return last_skipped;}
+
+//──── Bindings ──────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Make a program current (glUseProgram)
+         *
+        */
+        void use_program(GLuint program_id);
+        /**
+         * @brief Bind a vertex array object (glBindVertexArray)
+         *
+        */
+        void bind_vertex_array(GLuint array);
+        /**
+         * @brief Bind a buffer to a target (glBindBuffer)
+         *
+         * GL_ELEMENT_ARRAY_BUFFER is part of the bound VAO and is always bound.
+        */
+        void bind_buffer(GLenum target, GLuint buffer);
+        /**
+         * @brief Bind a whole buffer to an indexed binding point (glBindBufferBase)
+         *
+         * The buffer is also bound to the target itself, like OpenGL does.
+        */
+        void bind_buffer_base(GLenum target, GLuint index, GLuint buffer);
+        /**
+         * @brief Attach a buffer to a binding point of the bound VAO (glBindVertexBuffer)
+         *
+        */
+        void bind_vertex_buffer(GLuint index, GLuint buffer, GLintptr offset,
+            GLsizei stride);
+        /**
+         * @brief Bind a texture to a texture unit (glActiveTexture and glBindTexture)
+         *
+         * @param target Texture target (e.g GL_TEXTURE_2D)
+         * @param texture The texture
+         * @param unit Texture unit, -1 for the active one
+        */
+        void bind_texture(GLenum target, GLuint texture, GLint unit = -1);
+        /**
+         * @brief Bind a level of a texture to an image unit (glBindImageTexture)
+         *
+        */
+        void bind_image_texture(GLuint unit, GLuint texture, GLint level,
+            GLboolean layered, GLint layer, GLenum access, GLenum format);
+        /**
+         * @brief Get the buffer bound to an indexed binding point
+         *
+         * Only a binding that was never set through the cache is queried from OpenGL,
+         * the answer is then cached.
+         *
+         * @param target An indexed target (e.g GL_SHADER_STORAGE_BUFFER)
+         * @param index The binding point
+        */
+        GLuint getBufferBinding(GLenum target, GLuint index);
+        /**
+         * @brief Get the texture bound to an image unit, queried like getBufferBinding()
+         *
+        */
+        GLuint getImageBinding(GLuint unit);
+
+//──── Fixed Function State ──────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Enable a capability (glEnable)
+         *
+        */
+        void inline enable(GLenum capability){set_capability(capability, true);}
+        /**
+         * @brief Disable a capability (glDisable)
+         *
+        */
+        void inline disable(GLenum capability){set_capability(capability, false);}
+        /**
+         * @brief Enable or disable a capability
+         *
+        */
+        void set_capability(GLenum capability, bool enabled);
+        /**
+         * @brief Set the depth comparison (glDepthFunc)
+         *
+        */
+        void depth_func(GLenum function);
+        /**
+         * @brief Set the faces that are culled (glCullFace)
+         *
+        */
+        void cull_face(GLenum mode);
+        /**
+         * @brief Set the blend factors of every channel (glBlendFunc)
+         *
+        */
+        void blend_func(GLenum source, GLenum destination);
+
+//──── Bookkeeping ───────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Forget the whole state, after it was changed behind the cache's back
+         *
+        */
+        void invalidate();
+        /**
+         * @brief Delete buffers (glDeleteBuffers) and forget where they were bound
+         *
+        */
+        static void delete_buffers(GLsizei count, const GLuint *buffers);
+        /**
+         * @brief Delete textures (glDeleteTextures) and forget where they were bound
+         *
+        */
+        static void delete_textures(GLsizei count, const GLuint *textures);
+        /**
+         * @brief Delete vertex arrays (glDeleteVertexArrays) and forget their bindings
+         *
+        */
+        static void delete_vertex_arrays(GLsizei count, const GLuint *arrays);
+        /**
+         * @brief Delete a program (glDeleteProgram) and forget it was current
+         *
+        */
+        static void delete_program(GLuint program_id);
+        /**
+         * @brief Close the frame and make its counters available to the getters
+         *
+        */
+        void end_frame();
+};
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,322 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of GPU driven frustum and occlusion culling
+ *
+ * @file GPU-Culling.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "GPU-Culling.hpp"
+#include "Frustum-Culling.hpp"
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Depth Pyramid Class                                 *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Depth_Pyramid::Depth_Pyramid(int depth_width, int depth_height, string shader)
+{
+    width = depth_width;
+    height = depth_height;
+    levels = 1;
+    while((std::max(width, height) >> levels) > 0)
+        levels++;
+    view_projection = mat4(1);
+
+    glGenTextures(1, &texture);
+    GL_State::current().bind_texture(GL_TEXTURE_2D, texture);
+    glObjectLabel(GL_TEXTURE, texture, -1, "\"Depth pyramid\"");
+    glTexStorage2D(GL_TEXTURE_2D, levels, GL_R32F, width, height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    program = new Compute_Program(shader);
+}
+
+Depth_Pyramid::~Depth_Pyramid()
+{
+    GL_State::delete_textures(1, &texture);
+    delete(program);
+}
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+void Depth_Pyramid::build(GLuint depth_texture, const mat4 &frame_view_projection)
+{
+    program->use();
+    GL_State &state = GL_State::current();
+    state.bind_texture(GL_TEXTURE_2D, depth_texture, 0);
+    program->load_uniform(0, "depth");
+
+    //The first level copies the depth buffer, every other one reduces the level below
+    for(int level=0; level<levels; level++)
+    {
+        state.bind_image_texture(0, texture, std::max(level-1, 0), GL_FALSE, 0,
+            GL_READ_ONLY, GL_R32F);
+        state.bind_image_texture(1, texture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        program->load_uniform(level, "level");
+
+        int level_width = std::max(width >> level, 1);
+        int level_height = std::max(height >> level, 1);
+        //Reading the level written by the previous dispatch issues the image barrier
+        program->dispatch_threads(level_width, level_height);
+    }
+    view_projection = frame_view_projection;
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Culling Pass Class                                 *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Culling_Pass::Culling_Pass(string shader)
+{
+    regroup = false;
+    dirty = false;
+
+    GLuint buffers[4];
+    glGenBuffers(4, buffers);
+    instance_buffer = buffers[0];
+    draw_buffer = buffers[1];
+    command_buffer = buffers[2];
+    count_buffer = buffers[3];
+    GL_State &state = GL_State::current();
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, instance_buffer);
+    glObjectLabel(GL_BUFFER, instance_buffer, -1, "\"Culling instance buffer\"");
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, draw_buffer);
+    glObjectLabel(GL_BUFFER, draw_buffer, -1, "\"Culling draw buffer\"");
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, command_buffer);
+    glObjectLabel(GL_BUFFER, command_buffer, -1, "\"Culling command buffer\"");
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+    glObjectLabel(GL_BUFFER, count_buffer, -1, "\"Culling count buffer\"");
+
+    program = new Compute_Program(shader);
+
+    //Without a GPU written draw count every instance keeps its command slot
+    compact = GLEW_ARB_indirect_parameters;
+    if(!compact)
+        Log::record_log("GL_ARB_indirect_parameters is not supported, culled instances "
+            "are drawn with an instance count of 0\n");
+}
+
+Culling_Pass::~Culling_Pass()
+{
+    GLuint buffers[] = {instance_buffer, draw_buffer, command_buffer, count_buffer};
+    GL_State::delete_buffers(4, buffers);
+    delete(program);
+}
+
+//──── Instances ─────────────────────────────────────────────────────────────────────────
+
+int Culling_Pass::add(Mesh &mesh, const mat4 &model, uint lod)
+{
+    Cull_Instance instance = {};
+    Batch_Draw draw;
+    if(!Draw_Batch::make_draw(mesh, model, lod, instance.command, draw))
+        return -1;
+    instance.command.base_instance = instances.size();
+
+    vec3 center = mesh.sphere_center;
+    float radius = mesh.sphere_radius;
+    transform_sphere(model, center, radius);
+    instance.sphere = vec4(center, radius);
+
+    instances.push_back(instance);
+    draws.push_back(draw);
+    meshes.push_back(&mesh);
+    lods.push_back(lod);
+    revisions.push_back(mesh.revision);
+    regroup = true;
+    return instances.size() - 1;
+}
+
+void Culling_Pass::update(uint instance, const mat4 &model)
+{
+    Mesh &mesh = *meshes[instance];
+    vec3 center = mesh.sphere_center;
+    float radius = mesh.sphere_radius;
+    transform_sphere(model, center, radius);
+    instances[instance].sphere = vec4(center, radius);
+    draws[instance].model = model;
+    dirty = true;
+}
+
+void Culling_Pass::clear()
+{
+    instances.clear();
+    draws.clear();
+    meshes.clear();
+    lods.clear();
+    revisions.clear();
+    order.clear();
+    groups.clear();
+    regroup = false;
+    dirty = false;
+}
+
+void Culling_Pass::upload()
+{
+    //Levels of detail that arrived after an instance was added may have moved its mesh
+    for(uint i=0; i<instances.size(); i++)
+    {
+        Mesh &mesh = *meshes[i];
+        mesh.make_resident();
+        if(revisions[i] == mesh.revision)
+            continue;
+        Draw_Batch::make_draw(mesh, draws[i].model, lods[i], instances[i].command,
+            draws[i]);
+        instances[i].command.base_instance = i;
+        revisions[i] = mesh.revision;
+        regroup = true;
+    }
+
+    GL_State &state = GL_State::current();
+    if(regroup)
+    {
+        //Instances drawn by the same indirect call become consecutive
+        order.resize(instances.size());
+        for(uint i=0; i<order.size(); i++)
+            order[i] = i;
+        stable_sort(order.begin(), order.end(), [&](uint a, uint b)
+            {
+                Mesh *first = meshes[a], *second = meshes[b];
+                return first->VAO < second->VAO || (first->VAO == second->VAO &&
+                    first->index_type < second->index_type);
+            });
+
+        groups.clear();
+        for(uint i=0; i<order.size(); i++)
+        {
+            Mesh *mesh = meshes[order[i]];
+            if(groups.empty() || groups.back().VAO != mesh->VAO ||
+                groups.back().index_type != mesh->index_type)
+                groups.push_back({mesh, mesh->VAO, mesh->index_type, i, 0});
+            groups.back().count++;
+        }
+        for(uint g=0; g<groups.size(); g++)
+            for(uint i=groups[g].first; i<groups[g].first+groups[g].count; i++)
+            {
+                instances[order[i]].group = g;
+                instances[order[i]].output_first = groups[g].first;
+            }
+
+        state.bind_buffer(GL_SHADER_STORAGE_BUFFER, instance_buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, instances.size()*sizeof(Cull_Instance),
+            NULL, GL_DYNAMIC_DRAW);
+        state.bind_buffer(GL_SHADER_STORAGE_BUFFER, draw_buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, draws.size()*sizeof(Batch_Draw), NULL,
+            GL_DYNAMIC_DRAW);
+        state.bind_buffer(GL_SHADER_STORAGE_BUFFER, command_buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER,
+            instances.size()*sizeof(Draw_Elements_Command), NULL, GL_DYNAMIC_COPY);
+        state.bind_buffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, groups.size()*sizeof(GLuint), NULL,
+            GL_DYNAMIC_COPY);
+        regroup = false;
+        dirty = true;
+    }
+    if(!dirty)
+        return;
+
+    vector<Cull_Instance> sorted(order.size());
+    for(uint i=0; i<order.size(); i++)
+        sorted[i] = instances[order[i]];
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, instance_buffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sorted.size()*sizeof(Cull_Instance),
+        sorted.data());
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, draw_buffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, draws.size()*sizeof(Batch_Draw),
+        draws.data());
+    dirty = false;
+}
+
+//──── Culling and Drawing ───────────────────────────────────────────────────────────────
+
+void Culling_Pass::cull(Camera &camera, Depth_Pyramid *pyramid)
+{
+    if(instances.empty())
+        return;
+    upload();
+
+    Frustum frustum = camera.getFrustum();
+    program->use();
+    GLint planes = program->get_uniform_location("planes");
+    glProgramUniform4fv(program->getProgramID(), planes, 6,
+        value_ptr(frustum.planes[0]));
+    program->load_uniform(int(instances.size()), "instance_count");
+    program->load_uniform(int(compact), "compact");
+    program->load_uniform(int(pyramid != NULL), "occlusion");
+    if(pyramid)
+    {
+        GL_State::current().bind_texture(GL_TEXTURE_2D, pyramid->getTexture(), 0);
+        program->load_uniform(0, "depth_pyramid");
+        program->load_uniform(pyramid->getViewProjection(), "pyramid_view_projection");
+        program->load_uniform(pyramid->getLevels(), "pyramid_levels");
+    }
+
+    //Visible instances are appended after a count reset to 0 every frame
+    Compute_Program::barrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    GL_State &state = GL_State::current();
+    state.bind_buffer(GL_SHADER_STORAGE_BUFFER, count_buffer);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT,
+        NULL);
+    state.bind_buffer_base(GL_SHADER_STORAGE_BUFFER, HELIOS_CULL_INSTANCE_BINDING,
+        instance_buffer);
+    state.bind_buffer_base(GL_SHADER_STORAGE_BUFFER, HELIOS_CULL_COMMAND_BINDING,
+        command_buffer);
+    state.bind_buffer_base(GL_SHADER_STORAGE_BUFFER, HELIOS_CULL_COUNT_BINDING,
+        count_buffer);
+    program->dispatch_threads(instances.size());
+}
+
+void Culling_Pass::draw()
+{
+    if(groups.empty())
+        return;
+
+    //The commands and counts written by cull() are read by the indirect draws
+    Compute_Program::barrier(GL_COMMAND_BARRIER_BIT);
+    GL_State &state = GL_State::current();
+    state.bind_buffer_base(GL_SHADER_STORAGE_BUFFER, HELIOS_BATCH_DRAW_BINDING,
+        draw_buffer);
+    state.bind_buffer(GL_DRAW_INDIRECT_BUFFER, command_buffer);
+    if(compact)
+        state.bind_buffer(GL_PARAMETER_BUFFER_ARB, count_buffer);
+    for(uint g=0; g<groups.size(); g++)
+    {
+        groups[g].mesh->bind_vertex_buffers();
+        void *commands = (void*)(groups[g].first*sizeof(Draw_Elements_Command));
+        if(compact)
+            glMultiDrawElementsIndirectCountARB(GL_TRIANGLES, groups[g].index_type,
+                commands, g*sizeof(GLuint), groups[g].count, 0);
+        else
+            glMultiDrawElementsIndirect(GL_TRIANGLES, groups[g].index_type, commands,
+                groups[g].count, 0);
+    }
+}
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,290 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of GPU driven frustum and occlusion culling
+ *
+ * @file GPU-Culling.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+#include "Draw-Batch.hpp"
+#include "Camera.hpp"
+//########################################################################################
+
+/**
+ * @brief Shader storage binding point of the instances read by the culling shader
+ *
+*/
+#define HELIOS_CULL_INSTANCE_BINDING 2
+/**
+ * @brief Shader storage binding point of the draw commands written by the culling shader
+ *
+*/
+#define HELIOS_CULL_COMMAND_BINDING 3
+/**
+ * @brief Shader storage binding point of the visible draw counts of every group
+ *
+*/
+#define HELIOS_CULL_COUNT_BINDING 4
+/**
+ * @brief Default compute shader of a Culling_Pass
+ *
+*/
+#define HELIOS_CULL_SHADER "Helios-Shaders/Instance-Cull-Compute.glsl"
+/**
+ * @brief Default compute shader of a Depth_Pyramid
+ *
+*/
+#define HELIOS_DEPTH_PYRAMID_SHADER "Helios-Shaders/Depth-Pyramid-Compute.glsl"
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief An instance to cull, as laid out in the std430 storage buffer
+ *
+*/
+struct Cull_Instance
+{
+    glm::vec4 sphere;               //!< World space bounding sphere (center, radius)
+    Draw_Elements_Command command;  //!< Draw of the instance, base instance is its id
+    GLuint group;                   //!< Group of draws sharing a VAO and index type
+    GLuint output_first;            //!< First command written for the group
+    GLuint padding;                 //!< Unused, keeps the array 16 byte aligned
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Hierarchical depth buffer, every level holds the farthest depth of the 2x2
+ * texels of the level below
+ *
+ * Built from the depth buffer of a frame, it lets the next frame reject objects hidden
+ * behind what was drawn, by testing a handful of texels per object.
+*/
+class Depth_Pyramid
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        GLuint texture;         //!< GL_R32F texture with a level per reduction
+        int width;              //!< Width of the first level
+        int height;             //!< Height of the first level
+        int levels;             //!< Number of levels
+        glm::mat4 view_projection;  //!< Transform of the frame the pyramid was built from
+        Compute_Program *program;   //!< Reduction shader
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create the pyramid of a depth buffer
+         *
+         * @param depth_width Width of the depth buffer
+         * @param depth_height Height of the depth buffer
+         * @param shader Path of the reduction compute shader
+        */
+        Depth_Pyramid(int depth_width, int depth_height,
+            std::string shader = HELIOS_DEPTH_PYRAMID_SHADER);
+        /**
+         * @brief Delete the texture and the shader of the pyramid
+         *
+        */
+        ~Depth_Pyramid();
+
+        Depth_Pyramid(const Depth_Pyramid&) = delete;
+        Depth_Pyramid &operator=(const Depth_Pyramid&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the texture holding the pyramid
+         *
+        */
+        GLuint inline getTexture(){return texture;}
+        /**
+         * @brief Get the size of the first level
+         *
+        */
+        glm::vec2 inline getSize(){return glm::vec2(width, height);}
+        /**
+         * @brief Get the number of levels
+         *
+        */
+        int inline getLevels(){return levels;}
+        /**
+         * @brief Get the projection*view matrix of the frame the pyramid was built from
+         *
+        */
+        glm::mat4 inline getViewProjection(){return view_projection;}
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Rebuild the pyramid from a depth texture
+         *
+         * @param depth_texture Depth attachment of the frame, of the size of the pyramid
+         * @param frame_view_projection Projection*view matrix the frame was drawn with
+        */
+        void build(GLuint depth_texture, const glm::mat4 &frame_view_projection);
+};
+
+/**
+ * @brief Culls persistent mesh instances on the GPU and draws the visible ones
+ *
+ * Instances are added once and moved with update(). Every frame, cull() runs a
+ * compute shader that tests the bounding sphere of every instance against the camera
+ * frustum and, when given, a Depth_Pyramid of the previous frame. Visible instances are
+ * appended to an indirect command buffer, one range per group of instances sharing a
+ * VAO and index type, and their count is written to a parameter buffer that draw()
+ * passes to glMultiDrawElementsIndirectCountARB. The CPU never reads visibility back.
+ *
+ * Draws use the same per draw data as a Draw_Batch, so they are shaded with
+ * Batch-Vertex.glsl. Meshes imported with HELIOS_MESH_SHARED_BUFFERS share the VAO of
+ * their page and end up in the same group.
+ *
+ * @code
+ * culling.cull(camera, &pyramid);
+ * program->use();
+ * culling.draw();
+ * pyramid.build(depth_texture, camera.getPerspectiveMatrix()*camera.getViewMatrix());
+ * @endcode
+ *
+ * Without GL_ARB_indirect_parameters the commands are not compacted: culled instances
+ * are drawn with an instance count of 0.
+*/
+class Culling_Pass
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief Instances drawn by a single indirect call
+         *
+        */
+        struct Cull_Group
+        {
+            Mesh *mesh;         //!< A mesh of the group, binds the shared VAO
+            GLuint VAO;         //!< VAO of the meshes of the group
+            GLenum index_type;  //!< Type of the indices of the meshes of the group
+            uint first;         //!< First instance of the group in the instance buffer
+            uint count;         //!< Number of instances of the group
+        };
+
+        GLuint instance_buffer;     //!< Storage buffer of the Cull_Instance
+        GLuint draw_buffer;         //!< Storage buffer of the Batch_Draw
+        GLuint command_buffer;      //!< Commands written by the culling shader
+        GLuint count_buffer;        //!< Visible commands of every group
+        Compute_Program *program;   //!< Culling shader
+        bool compact;               //!< Whether the driver can draw a GPU written count
+
+        std::vector<Cull_Instance> instances;   //!< Instances, in insertion order
+        std::vector<Batch_Draw> draws;          //!< Per draw data of every instance
+        std::vector<Mesh*> meshes;              //!< Mesh of every instance
+        std::vector<uint> lods;                 //!< Level of detail of every instance
+        std::vector<uint> revisions;            //!< Mesh revision of every command
+        std::vector<uint> order;                //!< Instances sorted by group
+        std::vector<Cull_Group> groups;         //!< Groups of the last upload
+        bool regroup;               //!< Whether instances were added since the upload
+        bool dirty;                 //!< Whether instances moved since the upload
+
+        /**
+         * @brief Sort the instances into groups and upload them
+         *
+        */
+        void upload();
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create the buffers and the culling shader
+         *
+         * @param shader Path of the culling compute shader
+        */
+        Culling_Pass(std::string shader = HELIOS_CULL_SHADER);
+        /**
+         * @brief Delete the buffers and the culling shader
+         *
+        */
+        ~Culling_Pass();
+
+        Culling_Pass(const Culling_Pass&) = delete;
+        Culling_Pass &operator=(const Culling_Pass&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of instances
+         *
+        */
+        uint inline getInstanceCount(){return instances.size();}
+        /**
+         * @brief Get the number of indirect calls issued by draw()
+         *
+        */
+        uint inline getGroupCount(){return groups.size();}
+
+//──── Instances ─────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Add an instance of a mesh
+         *
+         * @param mesh The mesh, it must outlive the pass
+         * @param model Model matrix of the instance
+         * @param lod Level of detail drawn for the instance
+         * @return int Identifier of the instance, -1 if the mesh is not resident yet
+        */
+        int add(Mesh &mesh, const glm::mat4 &model, uint lod = 0);
+        /**
+         * @brief Move an instance
+         *
+         * @param instance Identifier returned by add()
+         * @param model New model matrix of the instance
+        */
+        void update(uint instance, const glm::mat4 &model);
+        /**
+         * @brief Remove every instance
+         *
+        */
+        void clear();
+
+//──── Culling and Drawing ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Write the draw commands of the instances visible from a camera
+         *
+         * @param camera The camera
+         * @param pyramid Depth of the previous frame, NULL to only cull against the
+         *        frustum. Instances hidden last frame that got uncovered by a fast camera
+         *        motion may appear one frame late
+        */
+        void cull(Camera &camera, Depth_Pyramid *pyramid = NULL);
+        /**
+         * @brief Draw the visible instances with the current program
+         *
+        */
+        void draw();
+};
+
+}//Close Helios namespace
+//########################################################################################
@@ -16,6 +16,18 @@
 
 #include "Helios-Wrappers.hpp"
 #include "Helios/System-Libraries.hpp"
+#include "Obj-Loader.hpp"
+#include "Normal-Generation.hpp"
+#include "Quantization.hpp"
+#include "Mesh-Optimizer.hpp"
+#include "Camera.hpp"
+#include "Frustum-Culling.hpp"
+#include "Asset-Registry.hpp"
+
+#include <regex>
+#include <cstring>
+#include <cstdio>
+#include <unistd.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb/stb_image.h"
@@ -32,33 +44,20 @@ using namespace glm;
  *                                                                                      */
 //========================================================================================
 /**
- * @brief Set the data for a VBO
+ * @brief Set the data of a buffer object
  *
- * @tparam T The type of the data with which to fill the buffer
+ * @param target The target to which to bind the buffer (e.g GL_ARRAY_BUFFER)
  * @param buffer The OpenGL ID of the buffer
- * @param data Vector containing the data to fill the buffer with
+ * @param data Pointer to the data with which to fill the buffer
+ * @param size Size in bytes of the data
+ * @param name Label of the buffer
 */
-template <class T>
-void inline static set_data_buffer(GLuint buffer, vector<T> &data, string name)
+void inline static set_buffer_data(GLenum target, GLuint buffer, const void *data,
+    size_t size, string name)
 {
-    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    Helios::GL_State::current().bind_buffer(target, buffer);
     glObjectLabel(GL_BUFFER, buffer, -1, name.c_str());
-    glBufferData(GL_ARRAY_BUFFER, sizeof(T)*data.size(), data.data(), GL_STATIC_DRAW);
-}
-/**
- * @brief Set the indices for indexed rendering in a VBO
- *
- * @tparam T The type if the index data  (should be uint, left as general just in case)
- * @param buffer The OpenGL ID of the buffer
- * @param data Vector containing the data to fill the buffer with
-*/
-template <class T>
-void inline static set_indices_buffer(GLuint buffer, vector<T> &data, string name)
-{
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
-    glObjectLabel(GL_BUFFER, buffer, -1, name.c_str());
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(T)*data.size(), data.data(),
-        GL_STATIC_DRAW);
+    glBufferData(target, size, data, GL_STATIC_DRAW);
 }
 /**
  * @brief Set the attribute locations for a shader
@@ -69,17 +68,20 @@ void inline static set_indices_buffer(GLuint buffer, vector<T> &data, string nam
  * Each index in one array represents one paremeter.
  *
  * @param locations Array of attribute locations
- * @param element_size Number of elements (counted as 4 bytes per element) per vertex instance
+ * @param element_size Number of components per vertex instance
+ * @param types Type of every component (e.g GL_FLOAT, GL_INT_2_10_10_10_REV)
  * @param normalize Should the values be normalized
  * @param element_distance Distance between consecutive elements in the array
+ * @param bindings Vertex buffer binding index from which each attribute is read
 */
 void inline static set_attribute_locations(vector<GLuint> &locations,
-    vector<GLint> &element_size, vector<GLboolean> &normalize,
-    vector<GLuint> &element_distance)
+    vector<GLint> &element_size, vector<GLenum> &types, vector<GLboolean> &normalize,
+    vector<GLuint> &element_distance, vector<GLuint> &bindings)
 {
     //check that array sizes match one another
-    if(locations.size()!=element_size.size() || locations.size()!=normalize.size() ||
-        locations.size()!=element_distance.size())
+    if(locations.size()!=element_size.size() || locations.size()!=types.size() ||
+        locations.size()!=normalize.size() || locations.size()!=element_distance.size() ||
+        locations.size()!=bindings.size())
     {
         cerr << "Un-matching array sizes for set_attribute_locations()" << endl;
         Log::record_log(std::string(80, '!') +
@@ -88,13 +90,48 @@ void inline static set_attribute_locations(vector<GLuint> &locations,
     }
     //Specify layout format for each target location (the way the data is to be read)
     //This needs to match the layout declarations in the shaders
-    int buffer_index = 0;
     for(uint i=0; i<locations.size(); i++)
     {
         glEnableVertexAttribArray(locations[i]);
         glVertexAttribFormat(locations[i], element_size[i],
-            GL_FLOAT, normalize[i], element_distance[i]);
-        glVertexAttribBinding(locations[i], buffer_index++);
+            types[i], normalize[i], element_distance[i]);
+        glVertexAttribBinding(locations[i], bindings[i]);
+    }
+}
+/**
+ * @brief Describe the vertex attributes of a mesh in the bound VAO
+ *
+ * @param flags Mesh_Flags of the mesh, only the layout options matter
+*/
+void static set_mesh_attributes(uint flags)
+{
+    //Set attribute location information
+    bool quantized = flags & Helios::HELIOS_MESH_QUANTIZED;
+    vector<GLuint> locs = {0,1,2};  // attribute locations 0,1,2
+    vector<GLint> sizes = quantized? vector<GLint>{4,4,2} : vector<GLint>{3,3,2};
+    vector<GLenum> types = quantized?
+        vector<GLenum>{GL_UNSIGNED_SHORT, GL_INT_2_10_10_10_REV, GL_HALF_FLOAT} :
+        vector<GLenum>{GL_FLOAT, GL_FLOAT, GL_FLOAT};
+    //Quantized positions are normalized to [0,1] and rescaled in the shader
+    vector<GLboolean> normalize = {quantized, true, false};
+    if(flags & Helios::HELIOS_MESH_INTERLEAVED)
+    {
+        //All attributes come from binding 0 at their offset inside the vertex
+        vector<GLuint> distance = quantized?
+            vector<GLuint>{offsetof(Helios::Quantized_Vertex, position),
+                offsetof(Helios::Quantized_Vertex, normal),
+                offsetof(Helios::Quantized_Vertex, uv)} :
+            vector<GLuint>{offsetof(Helios::Interleaved_Vertex, position),
+                offsetof(Helios::Interleaved_Vertex, normal),
+                offsetof(Helios::Interleaved_Vertex, uv)};
+        vector<GLuint> bindings = {0,0,0};
+        set_attribute_locations(locs, sizes, types, normalize, distance, bindings);
+    }
+    else
+    {
+        vector<GLuint> distance = {0,0,0}; //Distance between elements of the buffer
+        vector<GLuint> bindings = {0,1,2}; //One binding per attribute
+        set_attribute_locations(locs, sizes, types, normalize, distance, bindings);
     }
 }
 /**
@@ -109,6 +146,23 @@ string inline static extract_name(string file_path)
     size_t lastindex = name.find_last_of(".");
     return name.substr(0, lastindex);
 }
+/**
+ * @brief Append generated levels of detail after the indices of a mesh
+ *
+ * @param chain The simplified levels, coarser and coarser
+ * @param indices Indices of the mesh, the levels are added at the end
+ * @param lods Ranges of the levels of the mesh, one is added per level
+*/
+void static append_levels(const vector<Helios::Simplified_Mesh> &chain,
+    vector<uint> &indices, vector<Helios::Mesh_LOD> &lods)
+{
+    for(const Helios::Simplified_Mesh &level : chain)
+    {
+        lods.push_back({uint32_t(indices.size()), uint32_t(level.indices.size()),
+            level.error});
+        indices.insert(indices.end(), level.indices.begin(), level.indices.end());
+    }
+}
 //########################################################################################
 
 namespace Helios{
@@ -141,7 +195,7 @@ Texture::Texture(string file_path, GLuint t_target)
     //Create the texture OpenGL object
     target = t_target;
     glGenTextures(1, &textureID);
-    glBindTexture(target, textureID);
+    GL_State::current().bind_texture(target, textureID);
     //Name the texture
     glObjectLabel(GL_TEXTURE, textureID, -1,
         ("\"" + extract_name(file_path) +"\"").c_str());
@@ -170,21 +224,18 @@ Texture::Texture(string file_path, GLuint t_target)
 //Destructor
 Texture::~Texture()
 {
-    glDeleteTextures(1, &textureID);
+    GL_State::delete_textures(1, &textureID);
 }
 
 //Load the texture info to a program into a uniform sampler
-void Texture::load_to_program(Shading_Program *program, string uniform,
+void Texture::load_to_program(Shading_Program *program, Uniform_Name uniform,
     GLuint texture_unit)
 {
-    //Use program
-    program->use();
     //Bind texture to the texture unit to its appropriate target
-    glActiveTexture(GL_TEXTURE0 + texture_unit);
-	glBindTexture(target, textureID);
+    GL_State::current().bind_texture(target, textureID, texture_unit);
     //Get the uniform location in the program and attach the texture unit
-    GLuint location = program->get_uniform_location(uniform);
-    glUniform1i(location,texture_unit);
+    GLint location = program->get_uniform_location(uniform);
+    glProgramUniform1i(program->getProgramID(), location, texture_unit);
 }
 //########################################################################################
 
@@ -204,7 +255,7 @@ Image3D::Image3D(int w, int h, int d)
     target = GL_TEXTURE_3D;
     //Create the texture
     glGenTextures(1, &textureID);
-    glBindTexture(target, textureID);
+    GL_State::current().bind_texture(target, textureID);
     glObjectLabel(GL_TEXTURE, textureID, -1, "\"3D Texture\"");
     //Set the texture sampling parameters
     glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
@@ -223,7 +274,8 @@ void Image3D::load_to_program(Shading_Program *program, GLuint image_unit)
     //Use program
     program->use();
     //Attach this texture to shader defined image unit binding
-	glBindImageTexture(image_unit, textureID, 0, GL_TRUE, 0, GL_READ_WRITE, GL_RGBA8);
+    GL_State::current().bind_image_texture(image_unit, textureID, 0, GL_TRUE, 0,
+        GL_READ_WRITE, GL_RGBA8);
 }
 
 void Image3D::load_layer_to_program(Shading_Program *program,
@@ -232,7 +284,8 @@ void Image3D::load_layer_to_program(Shading_Program *program,
     //Use program
     program->use();
     //Attach this texture to shader defined image unit binding
-	glBindImageTexture(image_unit, textureID, 0, GL_FALSE, layer, GL_READ_WRITE, GL_RGBA8);
+    GL_State::current().bind_image_texture(image_unit, textureID, 0, GL_FALSE, layer,
+        GL_READ_WRITE, GL_RGBA8);
 }
 //########################################################################################
 
@@ -242,185 +295,843 @@ void Image3D::load_layer_to_program(Shading_Program *program,
  *                                                                                      */
 //========================================================================================
 
-//Enumerators used to index through the buffers[] array
-enum {MESH_VERTEX_BUFFER=0, MESH_NORMAL_BUFFER, MESH_UV_BUFFER, MESH_INDICES_BUFFER};
+/**
+ * @brief A page of the buffers shared by the meshes imported with
+ * HELIOS_MESH_SHARED_BUFFERS
+ *
+*/
+struct Mesh_Heap
+{
+    Buffer_Heap vertices;   //!< Interleaved vertices of the meshes
+    Buffer_Heap indices;    //!< Indices of the meshes, 16 and 32 bit ones side by side
+    bool quantized;         //!< Whether the vertices are Quantized_Vertex
+    GLuint VAO;             //!< VAO reading both buffers, made on the rendering context
+
+    Mesh_Heap(size_t vertex_size, size_t index_size, bool quantized_vertices, uint page) :
+        vertices(vertex_size, "\"Shared mesh vertex heap " + to_string(page) + "\""),
+        indices(index_size, "\"Shared mesh index heap " + to_string(page) + "\"")
+    {
+        quantized = quantized_vertices;
+        VAO = 0;
+    }
+};
+//Pages are never deleted, their buffers go away with the context at exit
+static vector<Mesh_Heap*> mesh_heaps;   //!< Every page of shared buffers
+static mutex mesh_heaps_mutex;          //!< Guards mesh_heaps
 
 //Default mesh constructor, for testing only
 Mesh::Mesh()
 {
+    heap = nullptr;
+    base_vertex = 0;
+    index_start = 0;
+    revision = 0;
+    failed = false;
+    assets = nullptr;
     //Create a triangle for illustration purposes
     vertices = {glm::vec3(-1,-1,0), glm::vec3(1,-1,0), glm::vec3(0,1,0)};
     normals = {glm::vec3(-1,-1,0), glm::vec3(1,-1,0), glm::vec3(0,1,0)};
     uvs = {vec2(0,0), vec2(1,0), vec2 (0,1)};
     indices = {0,1,2};
-
-    //Initialize VAO
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    glObjectLabel(GL_VERTEX_ARRAY, VAO, -1, "\"Generic mesh VAO\"");
-
-    //Initialize buffers and fill them with data
-    glGenBuffers(4, buffers);
-    set_data_buffer(buffers[MESH_VERTEX_BUFFER], vertices,
-        "\"Default Mesh Vertex Buffer\"");
-    set_data_buffer(buffers[MESH_NORMAL_BUFFER], normals,
-        "\"Default Mesh Normal Buffer\"");
-    set_data_buffer(buffers[MESH_UV_BUFFER], uvs,
-        "\"Default Mesh UV Buffer\"");
-    set_indices_buffer(buffers[MESH_INDICES_BUFFER], indices,
-        "\"Default Mesh Index Buffer\"");
-
-    //Set attribute location information
-    vector<GLuint> locs = {0,1,2};  // attribute locations 0,1,2
-    vector<GLint> sizes = {3,3,2};  // element sizes of 3,3,2 bytes (vec3, vec3, vec2)
-    vector<GLboolean> normalize = {false, true, false}; //Should the element be normalized
-    vector<GLuint> distance = {0,0,0}; //Distance between elements of the buffer
-    set_attribute_locations(locs, sizes, normalize, distance);
+    lods = {{0, 3, 0}};
+    submeshes = {{0, 3, 0}};
+    materials = {default_material("default")};
+    material_textures = {-1};
+    bounds_min = vec3(-1,-1,0);
+    bounds_max = vec3(1,1,0);
+    bounding_sphere(vertices, sphere_center, sphere_radius);
+    flags = HELIOS_MESH_DEFAULT;
+    source_path = "Default";
+    upload_fence = nullptr;
+
+    vertex_count = vertices.size();
+    vector<vector<char>> storage;
+    vector<Mesh_Block> blocks = create_blocks(indices, lods, storage);
+    upload_blocks(blocks, "Default");
+    create_vertex_arrays();
 }
 //Construct a mesh from a file
-Mesh::Mesh(string file_path)
+Mesh::Mesh(string file_path, uint mesh_flags, Asset_Registry *registry)
+{
+    assets = registry;
+    upload_fence = nullptr;
+    heap = nullptr;
+    base_vertex = 0;
+    index_start = 0;
+    revision = 0;
+    failed = false;
+    if(!load_buffers(file_path, mesh_flags))
+        exit(EXIT_FAILURE);   // call system to stop
+    create_vertex_arrays();
+}
+//Construct an empty mesh for Mesh_Loader
+Mesh::Mesh(Deferred_Load)
+{
+    VAO = 0;
+    position_VAO = 0;
+    for(GLuint &buffer : buffers)
+        buffer = 0;
+    flags = HELIOS_MESH_DEFAULT;
+    upload_fence = nullptr;
+    heap = nullptr;
+    base_vertex = 0;
+    index_start = 0;
+    revision = 0;
+    failed = false;
+    assets = nullptr;
+    sphere_center = vec3(0);
+    sphere_radius = 0;
+}
+//Import a mesh and fill its buffers
+bool Mesh::load_buffers(string file_path, uint mesh_flags)
 {
-    //Load an object from a wavefront file
-    load_from_obj(file_path);
-
     //Extract base file name
     string name = extract_name(file_path);
+    flags = mesh_flags;
+    if(flags & HELIOS_MESH_SHARED_BUFFERS)
+        flags |= HELIOS_MESH_INTERLEAVED;
+    source_path = file_path;
+
+    //Upload the result of a previous import if the file did not change since then
+    Mesh_Cache cache(file_path, flags);
+    if(cache.is_valid())
+    {
+        const Mesh_Cache_Header &header = cache.getHeader();
+        vertex_count = header.vertex_count;
+        bounds_min = vec3(header.bounds_min[0], header.bounds_min[1], header.bounds_min[2]);
+        bounds_max = vec3(header.bounds_max[0], header.bounds_max[1], header.bounds_max[2]);
+        sphere_center = vec3(header.bounding_sphere[0], header.bounding_sphere[1],
+            header.bounding_sphere[2]);
+        sphere_radius = header.bounding_sphere[3];
+
+        vector<Mesh_Block> blocks = cache.getBlocks();
+        upload_blocks(blocks, name);
+        load_textures();
+        return true;
+    }
 
-    //Initialize VAO
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    glObjectLabel(GL_VERTEX_ARRAY, VAO, -1, string("\"" + name + " mesh VAO\"").c_str());
+    //Load an object from a wavefront file
+    if(!load_from_obj(file_path))
+        return false;
+    if(flags & HELIOS_MESH_OPTIMIZE)
+        optimize();
+    if(flags & HELIOS_MESH_MESHLETS)
+    {
+        //Meshlets never mix materials, each range is split on its own
+        for(Submesh &submesh : submeshes)
+        {
+            auto first = indices.begin() + submesh.first_index;
+            vector<uint> range(first, first + submesh.index_count);
+            vector<Meshlet> clusters = build_meshlets(range, vertices);
+            copy(range.begin(), range.end(), first);
+            for(Meshlet &meshlet : clusters)
+            {
+                meshlet.first_index += submesh.first_index;
+                meshlets.push_back(meshlet);
+            }
+        }
+        Log::record_log("Split " + file_path + " into " + to_string(meshlets.size()) +
+            " meshlets\n");
+    }
 
-    //Initialize buffers and fill them with data
-    glGenBuffers(4, buffers);
-    set_data_buffer(buffers[MESH_VERTEX_BUFFER], vertices,
-        "\"" + name + " mesh vertex buffer\"");
-    set_data_buffer(buffers[MESH_NORMAL_BUFFER], normals,
-        "\"" + name + " mesh normal buffer\"");
-    set_data_buffer(buffers[MESH_UV_BUFFER], uvs,
-        "\"" + name + " mesh uv buffer\"");
-    set_indices_buffer(buffers[MESH_INDICES_BUFFER], indices,
-        "\"" + name + " mesh index buffer\"");
+    vertex_count = vertices.size();
+    vector<vector<char>> storage;
+    vector<Mesh_Block> blocks = create_blocks(indices, lods, storage);
+    upload_blocks(blocks, name);
+    load_textures();
 
-    //Set attribute location information
-    vector<GLuint> locs = {0,1,2};  // attribute locations 0,1,2
-    vector<GLint> sizes = {3,3,2};  // element sizes of 3,3,2 bytes (vec3, vec3, vec2)
-    vector<GLboolean> normalize = {false, true, false}; //Should the element be normalized
-    vector<GLuint> distance = {0,0,0}; //Distance between elements of the buffer
-    set_attribute_locations(locs, sizes, normalize, distance);
+    //Simplify on a worker thread, the cache is written as soon as the levels are ready
+    if(flags & HELIOS_MESH_LOD)
+    {
+        //The arrays read by the worker are not modified until poll_lods() gets the result
+        pending_lods = async(launch::async, [this]()
+        {
+            vector<Simplified_Mesh> chain = generate_lod_chain(vertices, normals, indices);
+            if(flags & HELIOS_MESH_OPTIMIZE)
+            {
+                vector<uint> clusters;
+                for(Simplified_Mesh &level : chain)
+                    optimize_vertex_cache(level.indices, vertices.size(), clusters);
+            }
+            //Writing the cache needs no context, the mesh may not be drawn for a while
+            vector<uint> chain_indices = indices;
+            vector<Mesh_LOD> chain_lods = lods;
+            append_levels(chain, chain_indices, chain_lods);
+            vector<vector<char>> chain_storage;
+            vector<Mesh_Block> chain_blocks = create_blocks(chain_indices, chain_lods,
+                chain_storage);
+            store_in_cache(chain_blocks, chain_indices.size());
+            return chain;
+        });
+        return true;
+    }
+
+    //Store the imported mesh for the next time it is loaded
+    store_in_cache(blocks, indices.size());
+    return true;
 }
 // Mesh destructor
 Mesh::~Mesh()
 {
-    glDeleteBuffers(4, buffers);
+    //The worker reads the arrays of the mesh
+    if(pending_lods.valid())
+        pending_lods.wait();
+    if(upload_fence)
+        glDeleteSync(upload_fence);
+
+    GL_State::delete_buffers(MESH_BUFFER_COUNT, buffers);
+    //The VAO of shared buffers belongs to their page
+    if(heap)
+    {
+        heap->vertices.release(heap_vertex_offset, heap_vertex_size);
+        heap->indices.release(heap_index_offset, heap_index_size);
+        return;
+    }
+    GL_State::delete_vertex_arrays(1, &VAO);
+    GL_State::delete_vertex_arrays(1, &position_VAO);
 }
-//Draw the mesh
-void Mesh::draw()
+//Describe the mesh arrays as blocks
+vector<Mesh_Block> Mesh::create_blocks(const vector<uint> &mesh_indices,
+    const vector<Mesh_LOD> &mesh_lods, vector<vector<char>> &storage)
+{
+    vector<Mesh_Block> blocks;
+    //The position stream is always kept on its own for depth only passes
+    if(flags & HELIOS_MESH_QUANTIZED)
+    {
+        storage.emplace_back(vertices.size()*4*sizeof(GLushort));
+        GLushort *positions = (GLushort*) storage.back().data();
+        for(uint i=0; i<vertices.size(); i++)
+            quantize_position(vertices[i], bounds_min, bounds_max, positions + 4*i);
+        blocks.push_back({MESH_BLOCK_POSITIONS, positions, storage.back().size()});
+    }
+    else
+        blocks.push_back({MESH_BLOCK_POSITIONS, vertices.data(),
+            vertices.size()*sizeof(vec3)});
+
+    if((flags & HELIOS_MESH_INTERLEAVED) && (flags & HELIOS_MESH_QUANTIZED))
+    {
+        storage.emplace_back(vertices.size()*sizeof(Quantized_Vertex));
+        Quantized_Vertex *interleaved = (Quantized_Vertex*) storage.back().data();
+        for(uint i=0; i<vertices.size(); i++)
+        {
+            quantize_position(vertices[i], bounds_min, bounds_max, interleaved[i].position);
+            interleaved[i].normal = pack_normal(normals[i]);
+            interleaved[i].uv[0] = float_to_half(uvs[i].x);
+            interleaved[i].uv[1] = float_to_half(uvs[i].y);
+        }
+        blocks.push_back({MESH_BLOCK_INTERLEAVED, interleaved, storage.back().size()});
+    }
+    else if(flags & HELIOS_MESH_INTERLEAVED)
+    {
+        storage.emplace_back(vertices.size()*sizeof(Interleaved_Vertex));
+        Interleaved_Vertex *interleaved = (Interleaved_Vertex*) storage.back().data();
+        for(uint i=0; i<vertices.size(); i++)
+            interleaved[i] = {vertices[i], normals[i], uvs[i]};
+
+        blocks.push_back({MESH_BLOCK_INTERLEAVED, interleaved, storage.back().size()});
+    }
+    else if(flags & HELIOS_MESH_QUANTIZED)
+    {
+        storage.emplace_back(normals.size()*sizeof(GLuint));
+        GLuint *packed_normals = (GLuint*) storage.back().data();
+        for(uint i=0; i<normals.size(); i++)
+            packed_normals[i] = pack_normal(normals[i]);
+        blocks.push_back({MESH_BLOCK_NORMALS, packed_normals, storage.back().size()});
+
+        storage.emplace_back(uvs.size()*2*sizeof(GLhalf));
+        GLhalf *half_uvs = (GLhalf*) storage.back().data();
+        for(uint i=0; i<uvs.size(); i++)
+        {
+            half_uvs[2*i] = float_to_half(uvs[i].x);
+            half_uvs[2*i+1] = float_to_half(uvs[i].y);
+        }
+        blocks.push_back({MESH_BLOCK_UVS, half_uvs, storage.back().size()});
+    }
+    else
+    {
+        blocks.push_back({MESH_BLOCK_NORMALS, normals.data(), normals.size()*sizeof(vec3)});
+        blocks.push_back({MESH_BLOCK_UVS, uvs.data(), uvs.size()*sizeof(vec2)});
+    }
+
+    //Use 16 bit indices whenever every vertex can be addressed with them
+    if(vertex_count <= 0xFFFF)
+    {
+        storage.emplace_back(mesh_indices.size()*sizeof(GLushort));
+        GLushort *short_indices = (GLushort*) storage.back().data();
+        copy(mesh_indices.begin(), mesh_indices.end(), short_indices);
+        blocks.push_back({MESH_BLOCK_INDICES, short_indices, storage.back().size()});
+    }
+    else
+        blocks.push_back({MESH_BLOCK_INDICES, mesh_indices.data(),
+            mesh_indices.size()*sizeof(uint)});
+    blocks.push_back({MESH_BLOCK_LODS, mesh_lods.data(),
+        mesh_lods.size()*sizeof(Mesh_LOD)});
+    if(!meshlets.empty())
+        blocks.push_back({MESH_BLOCK_MESHLETS, meshlets.data(),
+            meshlets.size()*sizeof(Meshlet)});
+    blocks.push_back({MESH_BLOCK_SUBMESHES, submeshes.data(),
+        submeshes.size()*sizeof(Submesh)});
+    blocks.push_back({MESH_BLOCK_MATERIALS, materials.data(),
+        materials.size()*sizeof(Material)});
+
+    return blocks;
+}
+//Create the OpenGL objects of the mesh and upload its data
+void Mesh::upload_blocks(vector<Mesh_Block> &blocks, string name)
 {
-    //Bind the buffers and draw their contents
-    GLintptr offsets[] = {0,0,0};
-    int strides[] = {sizeof(vec3),sizeof(vec3), sizeof(vec2)};
-    glBindVertexBuffers(0, 3, buffers, offsets, strides);
-    glDrawArrays(GL_TRIANGLES, 0, vertices.size());
+    //Initialize buffers and fill them with data
+    glGenBuffers(MESH_BUFFER_COUNT, buffers);
+    index_type = vertex_count <= 0xFFFF? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    if(flags & HELIOS_MESH_SHARED_BUFFERS)
+        place_in_heap(blocks);
+    for(Mesh_Block &block : blocks)
+    {
+        //Those already live in the shared buffers
+        bool shared = block.type == MESH_BLOCK_POSITIONS ||
+            block.type == MESH_BLOCK_INTERLEAVED || block.type == MESH_BLOCK_INDICES;
+        if(heap && shared)
+            continue;
+        switch(block.type)
+        {
+            case MESH_BLOCK_POSITIONS:
+                set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_VERTEX_BUFFER], block.data,
+                    block.size, "\"" + name + " mesh vertex buffer\"");
+                break;
+            case MESH_BLOCK_NORMALS:
+                set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_NORMAL_BUFFER], block.data,
+                    block.size, "\"" + name + " mesh normal buffer\"");
+                break;
+            case MESH_BLOCK_UVS:
+                set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_UV_BUFFER], block.data,
+                    block.size, "\"" + name + " mesh uv buffer\"");
+                break;
+            case MESH_BLOCK_INTERLEAVED:
+                set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_INTERLEAVED_BUFFER],
+                    block.data, block.size, "\"" + name + " mesh interleaved buffer\"");
+                break;
+            case MESH_BLOCK_INDICES:
+                //Element array bindings belong to VAOs, which may not exist yet
+                set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_INDICES_BUFFER],
+                    block.data, block.size, "\"" + name + " mesh index buffer\"");
+                break;
+            case MESH_BLOCK_LODS:
+            {
+                const Mesh_LOD *levels = (const Mesh_LOD*) block.data;
+                lods.assign(levels, levels + block.size/sizeof(Mesh_LOD));
+                index_count = lods[0].index_count;
+                break;
+            }
+            case MESH_BLOCK_MESHLETS:
+            {
+                //Kept on the CPU for culling and on the GPU for compute passes
+                set_buffer_data(GL_SHADER_STORAGE_BUFFER, buffers[MESH_MESHLET_BUFFER],
+                    block.data, block.size, "\"" + name + " mesh meshlet buffer\"");
+                const Meshlet *clusters = (const Meshlet*) block.data;
+                meshlets.assign(clusters, clusters + block.size/sizeof(Meshlet));
+                break;
+            }
+            case MESH_BLOCK_SUBMESHES:
+            {
+                const Submesh *ranges = (const Submesh*) block.data;
+                submeshes.assign(ranges, ranges + block.size/sizeof(Submesh));
+                break;
+            }
+            case MESH_BLOCK_MATERIALS:
+            {
+                const Material *library = (const Material*) block.data;
+                materials.assign(library, library + block.size/sizeof(Material));
+                break;
+            }
+        }
+    }
 }
-//Load mesh from .obj file
-void Mesh::load_from_obj(string file_path)
+//Create the vertex array objects of the mesh
+void Mesh::create_vertex_arrays()
 {
-    vector<vec3> vs, ns;
-    vector<vec2> ts;
+    string name = extract_name(source_path);
+    bool quantized = flags & HELIOS_MESH_QUANTIZED;
+    if(heap)
+    {
+        //Every mesh of a page is drawn with the VAO of the page
+        if(heap->VAO == 0)
+        {
+            glGenVertexArrays(1, &heap->VAO);
+            GL_State::current().bind_vertex_array(heap->VAO);
+            glObjectLabel(GL_VERTEX_ARRAY, heap->VAO, -1, "\"Shared mesh VAO\"");
+            GL_State::current().bind_buffer(GL_ELEMENT_ARRAY_BUFFER,
+                heap->indices.getBuffer());
+            set_mesh_attributes(flags);
+            GL_State::current().bind_vertex_buffer(0, heap->vertices.getBuffer(), 0,
+                quantized? sizeof(Quantized_Vertex) : sizeof(Interleaved_Vertex));
+        }
+        VAO = heap->VAO;
+        position_VAO = heap->VAO;
+        return;
+    }
 
-    ifstream wfile;
-    wfile.open(file_path);
-    //error check
-    if (!wfile) {
-        cerr << "Unable to open file " << file_path << " when creating mesh" <<endl;
-        Log::record_log(
-            string(80, '!') +
-            "Error with file " + file_path + " when crating mesh" +
-            string(80, '!')
-            );
-        exit(EXIT_FAILURE);   // call system to stop
+    //Initialize VAO
+    glGenVertexArrays(1, &VAO);
+    GL_State::current().bind_vertex_array(VAO);
+    glObjectLabel(GL_VERTEX_ARRAY, VAO, -1, string("\"" + name + " mesh VAO\"").c_str());
+    GL_State::current().bind_buffer(GL_ELEMENT_ARRAY_BUFFER,
+        buffers[MESH_INDICES_BUFFER]);
+    set_mesh_attributes(flags);
+
+    //Second VAO reading only the positions, the index buffer is shared
+    glGenVertexArrays(1, &position_VAO);
+    GL_State::current().bind_vertex_array(position_VAO);
+    glObjectLabel(GL_VERTEX_ARRAY, position_VAO, -1,
+        string("\"" + name + " mesh position VAO\"").c_str());
+    GL_State::current().bind_buffer(GL_ELEMENT_ARRAY_BUFFER,
+        buffers[MESH_INDICES_BUFFER]);
+    vector<GLuint> position_loc = {0};
+    vector<GLint> position_size = {quantized? 4 : 3};
+    vector<GLenum> position_type = {GLenum(quantized? GL_UNSIGNED_SHORT : GL_FLOAT)};
+    vector<GLboolean> position_normalize = {quantized};
+    vector<GLuint> position_distance = {0};
+    vector<GLuint> position_binding = {0};
+    set_attribute_locations(position_loc, position_size, position_type,
+        position_normalize, position_distance, position_binding);
+}
+//Sub-allocate the mesh from the shared buffers
+void Mesh::place_in_heap(vector<Mesh_Block> &blocks)
+{
+    const Mesh_Block *vertex_block = nullptr;
+    const Mesh_Block *index_block = nullptr;
+    for(Mesh_Block &block : blocks)
+    {
+        if(block.type == MESH_BLOCK_INTERLEAVED)
+            vertex_block = &block;
+        else if(block.type == MESH_BLOCK_INDICES)
+            index_block = &block;
     }
-    string line;
-    while(getline(wfile, line))
+    if(heap)
     {
-        //Create string stream and read the first word
-        stringstream ss(line);
-        string word;
-        ss >> word;
-        //If the first word in the line is 'v'
-        //then this is a vertex information line
-        if(word == "v")
+        heap->vertices.release(heap_vertex_offset, heap_vertex_size);
+        heap->indices.release(heap_index_offset, heap_index_size);
+    }
+
+    bool quantized = flags & HELIOS_MESH_QUANTIZED;
+    size_t stride = quantized? sizeof(Quantized_Vertex) : sizeof(Interleaved_Vertex);
+    //Empty ranges cannot be allocated, every mesh takes at least a vertex and an index
+    heap_vertex_size = std::max<size_t>(vertex_block->size, stride);
+    heap_index_size = std::max<size_t>(index_block->size, sizeof(GLuint));
+
+    lock_guard<mutex> lock(mesh_heaps_mutex);
+    heap = nullptr;
+    for(Mesh_Heap *page : mesh_heaps)
+    {
+        if(page->quantized != quantized ||
+            !page->vertices.allocate(heap_vertex_size, stride, heap_vertex_offset))
+            continue;
+        if(page->indices.allocate(heap_index_size, sizeof(GLuint), heap_index_offset))
         {
-            vector<double> coords;
-            //convert and store info to temporary vertex array
-            while(ss>>word)
-                coords.push_back(stof(word));
-            vs.push_back(vec3(coords[0], coords[1], coords[2]));
+            heap = page;
+            break;
         }
-        //If the first word in the line is 'vt' this is
-        //a texture coordinate information line
-        else if(word == "vt")
+        page->vertices.release(heap_vertex_offset, heap_vertex_size);
+    }
+    //Meshes larger than a page get a page of their own size
+    if(!heap)
+    {
+        heap = new Mesh_Heap(
+            std::max<size_t>(HELIOS_MESH_HEAP_VERTEX_SIZE, heap_vertex_size),
+            std::max<size_t>(HELIOS_MESH_HEAP_INDEX_SIZE, heap_index_size),
+            quantized, mesh_heaps.size());
+        mesh_heaps.push_back(heap);
+        heap->vertices.allocate(heap_vertex_size, stride, heap_vertex_offset);
+        heap->indices.allocate(heap_index_size, sizeof(GLuint), heap_index_offset);
+    }
+
+    heap->vertices.upload(heap_vertex_offset, vertex_block->data, vertex_block->size);
+    heap->indices.upload(heap_index_offset, index_block->data, index_block->size);
+    base_vertex = heap_vertex_offset/stride;
+    index_start = heap_index_offset;
+}
+//Add up the statistics of every page of shared buffers
+void Mesh::getSharedBufferStats(Heap_Stats &vertex_stats, Heap_Stats &index_stats)
+{
+    vertex_stats = {};
+    index_stats = {};
+    lock_guard<mutex> lock(mesh_heaps_mutex);
+    for(Mesh_Heap *page : mesh_heaps)
+    {
+        Heap_Stats page_stats[] = {page->vertices.getStats(), page->indices.getStats()};
+        Heap_Stats *totals[] = {&vertex_stats, &index_stats};
+        for(int i=0; i<2; i++)
         {
-           vector<double> coords;
-            //convert and store info to temporary uvs array
-            while(ss>>word)
-                coords.push_back(stof(word));
-            ts.push_back(vec2(coords[0], coords[1]));
+            totals[i]->capacity += page_stats[i].capacity;
+            totals[i]->used += page_stats[i].used;
+            totals[i]->free += page_stats[i].free;
+            totals[i]->largest_free =
+                std::max(totals[i]->largest_free, page_stats[i].largest_free);
+            totals[i]->free_ranges += page_stats[i].free_ranges;
+            totals[i]->allocations += page_stats[i].allocations;
         }
-        //If the first word in the line is 'vn' this is
-        //a normals information line
-        else if(word == "vn")
+    }
+    for(Heap_Stats *stats : {&vertex_stats, &index_stats})
+        stats->fragmentation = stats->free==0? 0 :
+            1.f - float(stats->largest_free)/stats->free;
+}
+//Write the mesh to its cache
+void Mesh::store_in_cache(vector<Mesh_Block> &blocks, size_t total_indices)
+{
+    Mesh_Cache_Header header = {};
+    header.import_flags = flags;
+    header.vertex_count = vertex_count;
+    header.index_count = total_indices;
+    for(int i=0; i<3; i++)
+    {
+        header.bounds_min[i] = bounds_min[i];
+        header.bounds_max[i] = bounds_max[i];
+        header.bounding_sphere[i] = sphere_center[i];
+    }
+    header.bounding_sphere[3] = sphere_radius;
+    Mesh_Cache::write(source_path, header, blocks);
+}
+//Upload the levels of detail generated by the worker
+void Mesh::poll_lods()
+{
+    if(!pending_lods.valid() ||
+        pending_lods.wait_for(chrono::seconds(0)) != future_status::ready)
+        return;
+
+    vector<Simplified_Mesh> chain = pending_lods.get();
+    append_levels(chain, indices, lods);
+    revision++;
+    Log::record_log("Generated " + to_string(chain.size()) + " levels of detail for " +
+        source_path + "\n");
+
+    //Every level lives in the same index buffer, only that buffer changes
+    vector<vector<char>> storage;
+    vector<Mesh_Block> blocks = create_blocks(indices, lods, storage);
+    if(heap)
+    {
+        //The index range grew, the mesh may move to another page
+        place_in_heap(blocks);
+        create_vertex_arrays();
+    }
+    for(Mesh_Block &block : blocks)
+    {
+        if(heap || block.type != MESH_BLOCK_INDICES)
+            continue;
+        set_buffer_data(GL_ARRAY_BUFFER, buffers[MESH_INDICES_BUFFER], block.data,
+            block.size, "\"" + extract_name(source_path) + " mesh index buffer\"");
+    }
+}
+//Finish an asynchronous load once its uploads are complete
+bool Mesh::make_resident()
+{
+    if(VAO != 0)
+    {
+        poll_lods();
+        return true;
+    }
+    GLsync fence = upload_fence;
+    if(!fence)
+        return false;
+    GLenum status = glClientWaitSync(fence, 0, 0);
+    if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return false;
+
+    glDeleteSync(fence);
+    upload_fence = nullptr;
+    //Vertex array objects are not shared between contexts, create them here
+    create_vertex_arrays();
+    poll_lods();
+    return true;
+}
+//Draw the mesh
+void Mesh::draw()
+{
+    draw_lod(0);
+}
+//Draw a level of detail of the mesh
+void Mesh::draw_lod(uint lod)
+{
+    if(!make_resident())
+        return;
+    lod = std::min<uint>(lod, lods.size()-1);
+    bind_vertex_buffers();
+    GLsizeiptr index_size = index_type==GL_UNSIGNED_SHORT? sizeof(GLushort) : sizeof(GLuint);
+    glDrawElementsBaseVertex(GL_TRIANGLES, lods[lod].index_count, index_type,
+        (void*)(index_start + lods[lod].first_index*index_size), base_vertex);
+}
+//Draw several instances of a level of detail
+void Mesh::draw_instanced(Instance_Buffer &instances, uint first, uint count, uint lod)
+{
+    if(!make_resident() || first >= instances.getCapacity())
+        return;
+    count = std::min(count, instances.getCapacity() - first);
+    lod = std::min<uint>(lod, lods.size()-1);
+
+    instances.bind();
+    bind_vertex_buffers();
+    GLsizeiptr index_size = index_type==GL_UNSIGNED_SHORT? sizeof(GLushort) : sizeof(GLuint);
+    glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, lods[lod].index_count,
+        index_type, (void*)(index_start + lods[lod].first_index*index_size), count,
+        base_vertex, first);
+}
+//Draw the meshlets that pass culling
+uint Mesh::draw_meshlets(Camera &camera, const mat4 &model)
+{
+    if(!make_resident())
+        return 0;
+    if(meshlets.empty())
+    {
+        draw();
+        return 0;
+    }
+
+    //Cull in the object space of the mesh
+    vec4 planes[6];
+    extract_frustum_planes(camera.getPerspectiveMatrix()*camera.getViewMatrix()*model,
+        planes);
+    vec3 eye = vec3(inverse(model)*vec4(camera.getPosition(), 1));
+
+    //Consecutive visible meshlets are contiguous in the index buffer, merge them
+    GLsizeiptr index_size = index_type==GL_UNSIGNED_SHORT? sizeof(GLushort) : sizeof(GLuint);
+    vector<GLsizei> counts;
+    vector<const void*> offsets;
+    uint visible = 0;
+    uint range_end = 0xFFFFFFFFu;
+    for(Meshlet &meshlet : meshlets)
+    {
+        if(!meshlet_visible(meshlet, planes, eye))
+            continue;
+        visible++;
+        if(meshlet.first_index == range_end)
+            counts.back() += meshlet.index_count;
+        else
         {
-            vector<double> coords;
-            //convert and store info to temporary vertex array
-            while(ss>>word)
-                coords.push_back(stof(word));
-            ns.push_back(vec3(coords[0], coords[1], coords[2]));
+            counts.push_back(meshlet.index_count);
+            offsets.push_back((void*)(index_start + meshlet.first_index*index_size));
         }
+        range_end = meshlet.first_index + meshlet.index_count;
     }
-    //reset stream to the beggining of the file
-    wfile.clear();
-    wfile.seekg(0, ios::beg);
-    //once again read every line
-    while(getline(wfile, line))
-    {
-        //once again read word by word
-        stringstream ss(line);
-        string word;
-        ss >> word;
-        //if the first word is 'f' this is a face information line
-        if(word == "f")
+
+    bind_vertex_buffers();
+    vector<GLint> base_vertices(counts.size(), base_vertex);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts.data(), index_type, offsets.data(),
+        counts.size(), base_vertices.data());
+    return visible;
+}
+//Bind the VAO and the vertex buffers of the mesh
+void Mesh::bind_vertex_buffers()
+{
+    GL_State &state = GL_State::current();
+    state.bind_vertex_array(VAO);
+    //The VAO of a page of shared buffers already points at them
+    if(heap)
+        return;
+    //Buffers already attached to the VAO by an earlier draw are skipped
+    bool quantized = flags & HELIOS_MESH_QUANTIZED;
+    if(flags & HELIOS_MESH_INTERLEAVED)
+        state.bind_vertex_buffer(0, buffers[MESH_INTERLEAVED_BUFFER], 0,
+            quantized? sizeof(Quantized_Vertex) : sizeof(Interleaved_Vertex));
+    else
+    {
+        int strides[] = {sizeof(vec3),sizeof(vec3), sizeof(vec2)};
+        int quantized_strides[] = {4*sizeof(GLushort), sizeof(GLuint), 2*sizeof(GLhalf)};
+        for(GLuint stream=0; stream<3; stream++)
+            state.bind_vertex_buffer(stream, buffers[stream], 0,
+                quantized? quantized_strides[stream] : strides[stream]);
+    }
+}
+//Select the level of detail from the projected error
+uint Mesh::select_lod(Camera &camera, const mat4 &model, float pixel_error)
+{
+    if(!make_resident())
+        return 0;
+
+    //Bounding sphere of the instance in view space
+    vec3 center = sphere_center;
+    float radius = sphere_radius;
+    transform_sphere(camera.getViewMatrix()*model, center, radius);
+    float scale = glm::max(length(vec3(model[0])),
+        glm::max(length(vec3(model[1])), length(vec3(model[2]))));
+    float distance = length(center) - radius;
+    if(distance <= 0)
+        return 0;
+
+    //Pixels covered by one object space unit at the distance of the sphere
+    float pixels_per_unit =
+        camera.getPerspectiveMatrix()[1][1]*camera.getHeight()*0.5f*scale/distance;
+    for(uint lod=lods.size()-1; lod>0; lod--)
+        if(lods[lod].error*pixels_per_unit <= pixel_error)
+            return lod;
+    return 0;
+}
+//Create the textures used by the materials
+void Mesh::load_textures()
+{
+    //Shared by the meshes that were not given a registry
+    static Asset_Registry default_assets;
+    Asset_Registry &registry = assets? *assets : default_assets;
+
+    textures.clear();
+    material_textures.assign(materials.size(), -1);
+    vector<string> paths;
+    for(uint i=0; i<materials.size(); i++)
+    {
+        string path = materials[i].diffuse_map;
+        if(path.empty())
+            continue;
+        //Materials sharing a texture share its handle
+        int texture = find(paths.begin(), paths.end(), path) - paths.begin();
+        if(texture == int(paths.size()))
         {
-            //process the word, there should be 3 consecutive such words only
-            while(ss>>word)
+            struct stat info;
+            if(stat(path.c_str(), &info) != 0)
             {
-                //split the string
-                replace(word.begin(), word.end(), '/', ' ');
-
-                //Store index information of the vertex/texture/normal relationship
-                stringstream ws(word);
-                vector<int> indices;
-                string number;
-                for(int i=0; i<3; i++)
-                {
-                    ws >> number;
-                    indices.push_back(stoi(number)-1);
-                }
-
-                //Push associated vertex and normal information into the return arrays
-                //Now each vertex is associated with the correct normal.
-                vertices.push_back(vs[indices[0]]);
-                normals.push_back(ns[indices[2]]);
-
-                //Same as above for texture coordinates
-                    uvs.push_back(ts[indices[1]]);
-
+                Log::record_log("Texture " + path + " of material " +
+                    string(materials[i].name) + " not found\n");
+                continue;
             }
+            paths.push_back(path);
+            textures.push_back(registry.getTexture(path, GL_TEXTURE_2D));
         }
+        material_textures[i] = texture;
+    }
+}
+//Draw every material range
+void Mesh::draw_materials(Shading_Program *program, GLuint texture_unit)
+{
+    if(!make_resident())
+        return;
+    static constexpr Uniform_Name diffuse_uniform("material_diffuse");
+    static constexpr Uniform_Name specular_uniform("material_specular");
+    static constexpr Uniform_Name shininess_uniform("material_shininess");
+    static constexpr Uniform_Name opacity_uniform("material_opacity");
+    static constexpr Uniform_Name use_map_uniform("use_diffuse_map");
+    static constexpr Uniform_Name map_uniform("diffuse_map");
+    //Locations of undeclared uniforms are -1, which glProgramUniform calls ignore
+    GLuint program_id = program->getProgramID();
+    GLint diffuse = program->find_uniform(diffuse_uniform);
+    GLint specular = program->find_uniform(specular_uniform);
+    GLint shininess = program->find_uniform(shininess_uniform);
+    GLint opacity = program->find_uniform(opacity_uniform);
+    GLint use_map = program->find_uniform(use_map_uniform);
+    glProgramUniform1i(program_id, program->find_uniform(map_uniform), texture_unit);
+    program->use();
+
+    bind_vertex_buffers();
+    GLsizeiptr index_size = index_type==GL_UNSIGNED_SHORT? sizeof(GLushort) : sizeof(GLuint);
+    int bound_texture = -1;
+    for(Submesh &submesh : submeshes)
+    {
+        Material &material = materials[submesh.material];
+        glProgramUniform3fv(program_id, diffuse, 1, value_ptr(material.diffuse));
+        glProgramUniform3fv(program_id, specular, 1, value_ptr(material.specular));
+        glProgramUniform1f(program_id, shininess, material.shininess);
+        glProgramUniform1f(program_id, opacity, material.opacity);
+
+        //Ranges are sorted by texture, each one is bound a single time
+        int texture = material_textures[submesh.material];
+        glProgramUniform1i(program_id, use_map, texture >= 0);
+        if(texture >= 0 && texture != bound_texture)
+        {
+            textures[texture]->bind(texture_unit);
+            bound_texture = texture;
+        }
+        glDrawElementsBaseVertex(GL_TRIANGLES, submesh.index_count, index_type,
+            (void*)(index_start + submesh.first_index*index_size), base_vertex);
+    }
+}
+//Draw only the positions of the mesh
+void Mesh::draw_positions()
+{
+    if(!make_resident())
+        return;
+    GL_State::current().bind_vertex_array(position_VAO);
+    //Shared buffers have no position stream, the interleaved vertices are read instead
+    if(!heap)
+        GL_State::current().bind_vertex_buffer(0, buffers[MESH_VERTEX_BUFFER], 0,
+            (flags & HELIOS_MESH_QUANTIZED)? 4*sizeof(GLushort) : sizeof(vec3));
+    glDrawElementsBaseVertex(GL_TRIANGLES, index_count, index_type, (void*)index_start,
+        base_vertex);
+}
+//Load the dequantization parameters to a program
+void Mesh::load_to_program(Shading_Program *program)
+{
+    if(!make_resident())
+        return;
+    //Non quantized positions are used as they are
+    vec3 scale = vec3(1);
+    vec3 offset = vec3(0);
+    if(flags & HELIOS_MESH_QUANTIZED)
+    {
+        scale = quantization_extent(bounds_min, bounds_max);
+        offset = bounds_min;
+    }
+    //Shaders written before quantization do not declare them, -1 is ignored
+    static constexpr Uniform_Name scale_uniform("position_scale");
+    static constexpr Uniform_Name offset_uniform("position_offset");
+    GLuint program_id = program->getProgramID();
+    glProgramUniform3fv(program_id, program->find_uniform(scale_uniform), 1,
+        value_ptr(scale));
+    glProgramUniform3fv(program_id, program->find_uniform(offset_uniform), 1,
+        value_ptr(offset));
+}
+//Load mesh from .obj file
+bool Mesh::load_from_obj(string file_path)
+{
+    Obj_Data data;
+    if(!load_obj(file_path, data))
+        return false;
+
+    //Scanned data often comes without normals
+    if(missing_normals(data))
+    {
+        generate_normals(data, (flags & HELIOS_MESH_CREASE_NORMALS)?
+            HELIOS_CREASE_ANGLE : HELIOS_SMOOTH_NORMALS);
+        Log::record_log("Generated normals for " + file_path + "\n");
+    }
+    //Make the faces of every material contiguous before the vertices are merged
+    materials = load_obj_materials(file_path, data);
+    submeshes = group_by_material(data, materials);
+
+    //Merge the corners that share all of their attributes into single vertices
+    build_indexed_mesh(data, vertices, normals, uvs, indices);
+    index_count = indices.size();
+    lods = {{0, uint32_t(index_count), 0}};
+
+    //Compute the axis aligned bounding box
+    bounds_min = vertices.empty()? vec3(0) : vertices[0];
+    bounds_max = bounds_min;
+    for(vec3 &v : vertices)
+    {
+        bounds_min = glm::min(bounds_min, v);
+        bounds_max = glm::max(bounds_max, v);
     }
-    //Close the file
-    wfile.close();
+    bounding_sphere(vertices, sphere_center, sphere_radius);
+    return true;
+}
+//Optimize triangle and vertex order
+void Mesh::optimize()
+{
+    Vertex_Cache_Stats before = analyze_vertex_cache(indices, vertices.size());
+
+    //Reorder each material range on its own so that ranges stay contiguous
+    for(Submesh &submesh : submeshes)
+    {
+        auto first = indices.begin() + submesh.first_index;
+        vector<uint> range(first, first + submesh.index_count);
+        vector<uint> clusters;
+        optimize_vertex_cache(range, vertices.size(), clusters);
+        optimize_overdraw(range, vertices, clusters);
+        copy(range.begin(), range.end(), first);
+    }
+
+    vector<uint> order = optimize_vertex_fetch(indices, vertices.size());
+    remap_attribute(vertices, order);
+    remap_attribute(normals, order);
+    remap_attribute(uvs, order);
+
+    Vertex_Cache_Stats after = analyze_vertex_cache(indices, vertices.size());
+    Log::record_log("Mesh optimized: ACMR " + to_string(before.acmr) + " -> " +
+        to_string(after.acmr) + ", ATVR " + to_string(before.atvr) + " -> " +
+        to_string(after.atvr) + "\n");
 }
 //########################################################################################
 
@@ -609,20 +1320,190 @@ void static verify_linking(GLuint programID, string vs, string tcs, string tes,
 }
 #undef E_MESS
 
+//Identifies the layout of the files in HELIOS_PROGRAM_CACHE_DIRECTORY
+#define HPROG_VERSION 1
+
+/**
+ * @brief Header at the start of a cached program binary, the binary follows it
+ *
+*/
+struct Program_Cache_Header
+{
+    char magic[4];      //!< Always "HPRG"
+    uint32_t version;   //!< HPROG_VERSION when the file was written
+    uint32_t format;    //!< Format returned by glGetProgramBinary
+    uint32_t size;      //!< Size in bytes of the binary
+    uint64_t key;       //!< Hash of the sources and driver the binary was built from
+};
+
+/**
+ * @brief Fold a range of bytes into a 64 bit FNV-1a hash
+ *
+*/
+void static hash_append(uint64_t &hash, const char *data, size_t size)
+{
+    for(size_t i=0; i<size; i++)
+        hash = (hash ^ uint8_t(data[i])) * 1099511628211ull;
+    //Separate consecutive ranges so that moving bytes between them changes the hash
+    hash = (hash ^ size) * 1099511628211ull;
+}
+
+/**
+ * @brief Hash the shader sources of a program with the driver that will compile them
+ *
+ * A binary is only valid for the driver that produced it, so the vendor, renderer and
+ * version strings of the current context are part of the key. Updating the driver or
+ * editing any stage yields a different key and the old binary is simply not found.
+ *
+ * @param paths Source file of every stage, indexed like shaders[] ("" if unused)
+ * @param key Where to store the hash
+ * @return true If every source could be read
+ * @return false If a source could not be read, the program is compiled normally
+*/
+bool static program_cache_key(const string (&paths)[6], uint64_t &key)
+{
+    key = 1469598103934665603ull;
+    for(GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const char *value = (const char*)glGetString(name);
+        value = value == NULL? "" : value;
+        hash_append(key, value, strlen(value));
+    }
+    for(int stage=0; stage<6; stage++)
+    {
+        char stage_id = char(stage);
+        hash_append(key, &stage_id, 1);
+        if(paths[stage] == "")
+            continue;
+
+        ifstream input(paths[stage].c_str(), ios::binary);
+        if(!input)
+            return false;
+        string source((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+        hash_append(key, source.data(), source.size());
+    }
+    return true;
+}
+
+/**
+ * @brief Get the path of the cached binary of a program
+ *
+*/
+string static program_cache_path(uint64_t key)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long) key);
+    return string(HELIOS_PROGRAM_CACHE_DIRECTORY) + "/" + name + ".hprog";
+}
+
+/**
+ * @brief Load a cached binary into a program
+ *
+ * @param programID Program without attached shaders
+ * @param key Hash of the sources and driver
+ * @return true If the program is linked from the binary
+ * @return false If there is no usable binary, the program must be compiled
+*/
+bool static load_program_binary(GLuint programID, uint64_t key)
+{
+    ifstream input(program_cache_path(key).c_str(), ios::binary);
+    if(!input)
+        return false;
+
+    Program_Cache_Header header;
+    input.read((char*)&header, sizeof(header));
+    if(!input || memcmp(header.magic, "HPRG", 4) != 0 || header.version != HPROG_VERSION
+        || header.key != key)
+        return false;
+    vector<char> binary(header.size);
+    input.read(binary.data(), binary.size());
+    if(!input)
+        return false;
+
+    //The driver may still reject the binary (e.g a format it no longer accepts)
+    glProgramBinary(programID, header.format, binary.data(), binary.size());
+    GLint linked = GL_FALSE;
+    glGetProgramiv(programID, GL_LINK_STATUS, &linked);
+    return linked == GL_TRUE;
+}
+
+/**
+ * @brief Store the binary of a linked program in the cache
+ *
+ * @param programID Program linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set
+ * @param key Hash of the sources and driver
+*/
+void static save_program_binary(GLuint programID, uint64_t key)
+{
+    GLint size = 0;
+    glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &size);
+    if(size <= 0)
+        return;
+    Program_Cache_Header header = {{'H', 'P', 'R', 'G'}, HPROG_VERSION, 0, 0, key};
+    vector<char> binary(size);
+    GLenum format;
+    glGetProgramBinary(programID, size, &size, &format, binary.data());
+    header.format = format;
+    header.size = size;
+
+    //Write to a temporary file and rename it so readers never see a partial binary
+    string directory = HELIOS_PROGRAM_CACHE_DIRECTORY;
+    mkdir(directory.substr(0, directory.find_last_of('/')).c_str(), S_IRWXU);
+    mkdir(directory.c_str(), S_IRWXU);
+
+    string path = program_cache_path(key);
+    string temporary = path + "." + to_string(getpid()) + ".tmp";
+    ofstream output(temporary, ios::binary | ios::trunc);
+    if(output)
+    {
+        output.write((const char*)&header, sizeof(header));
+        output.write(binary.data(), size);
+        output.close();
+    }
+    if(!output || rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+        Log::record_log("Could not write program cache " + path);
+    }
+}
+
 //Each string is either null or a pointer to the path to the source shader file
 Shading_Program::Shading_Program(string vs, string tcs, string tes,
     string gs, string fs, string cs)
 {
-    //TODO: this needs better error checking
-    if(vs == "" || fs == "")
+    //A program either rasterizes (vertex and fragment shaders) or computes, never both
+    bool compute = cs != "" && vs == "" && tcs == "" && tes == "" && gs == "" && fs == "";
+    if(!compute && (vs == "" || fs == ""))
     {
-        cerr << "Both the vertex shader and the fragment shader need to be specified\n";
+        cerr << "Both the vertex shader and the fragment shader need to be specified, " <<
+            "or only a compute shader\n";
+        Log::record_log(string(80, '!') + "\nShader program with neither a vertex and " +
+            "fragment shader pair nor a lone compute shader\n" + string(80, '!'));
         exit(EXIT_FAILURE);
     }
+	//Initialize and create the rendering program
+	programID = glCreateProgram();
+    string name = string(basename((char*) (compute? cs : vs).c_str()));
+    size_t lastindex = name.find_last_of("-");
+    name = name.substr(0, lastindex);
+    glObjectLabel(GL_PROGRAM, programID, -1, ("\""+name+"\"").c_str());
+
+    //Reuse the binary of an earlier run when the sources and the driver are unchanged
+    GLint binary_formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats);
+    const string paths[6] = {vs, tcs, tes, gs, fs, cs};
+    uint64_t key;
+    bool cached = binary_formats > 0 && program_cache_key(paths, key);
+    if(cached && load_program_binary(programID, key))
+    {
+        reflect_uniforms();
+        return;
+    }
+
     vector<Shader*> shaders = vector<Shader*>(6);
     //Initialize mandatory shaders
-    shaders[HELIOS_VERTEX_S] = new Shader(vs);
-	shaders[HELIOS_FRAGMENT_S] = new Shader(fs);
+    shaders[HELIOS_VERTEX_S] = vs == ""? NULL: new Shader(vs);
+	shaders[HELIOS_FRAGMENT_S] = fs == ""? NULL: new Shader(fs);
 
     //Conditionally initialize optional shaders
     shaders[HELIOS_TESSC_S]= tcs == ""? NULL: new Shader(tcs);
@@ -630,21 +1511,19 @@ Shading_Program::Shading_Program(string vs, string tcs, string tes,
     shaders[HELIOS_GEOMETRY_S] = gs == ""? NULL: new Shader(gs);
     shaders[HELIOS_COMPUTE_S] = cs == ""? NULL: new Shader(cs);
 
-	//Initialize and create the rendering program
-	programID = glCreateProgram();
-    string name = string(basename((char*) vs.c_str()));
-    size_t lastindex = name.find_last_of("-");
-    name = name.substr(0, lastindex);
-    glObjectLabel(GL_PROGRAM, programID, -1, ("\""+name+"\"").c_str());
-
     //Attach shaders if available
     for(int c_shader=0; c_shader < shaders.size(); c_shader++)
         if(shaders[c_shader]!=NULL)
             shaders[c_shader]->attachTo(programID);
 
     //Attempt to link the GLSL program
+    if(cached)
+        glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 	glLinkProgram(programID);
     verify_linking(programID, vs, tcs, tes, gs, fs, cs);
+    reflect_uniforms();
+    if(cached)
+        save_program_binary(programID, key);
 
     //Delete the saders, they are no longer needed once we have the program
     for(int c_shader=0; c_shader < shaders.size(); c_shader++)
@@ -659,51 +1538,324 @@ Shading_Program::Shading_Program(string vs, string tcs, string tes,
 
 Shading_Program::~Shading_Program()
 {
-    glDeleteProgram(programID);
+    GL_State::delete_program(programID);
 }
 
 //──── Other Functions ───────────────────────────────────────────────────────────────────
 
         //Retrieve uniform location
-        GLint Shading_Program::get_uniform_location(std::string name)
+        GLint Shading_Program::get_uniform_location(Uniform_Name name)
         {
-            //Get the current active program
-            use();
-            //Get the location of the uniform in the shader
-            GLint loc = glGetUniformLocation(programID, name.c_str());
+            GLint loc = find_uniform(name);
             //Error handling
-            if(loc == GL_INVALID_VALUE || loc==GL_INVALID_OPERATION || loc==-1)
+            if(loc == -1)
             {
                 std::cerr << "Error returned when trying to find uniform " <<
-                    "\"" + name + "\"" << std::endl;
-
-                if(loc == -1)
-                {
-                    char label_buffer[100];
-                    GLsizei buff_size;
-                    glGetObjectLabel(GL_PROGRAM, programID, 100, &buff_size, label_buffer);
-
-                    Log::record_log(
-                        std::string(80, '!') + "\nFailed to find uniform: " + name + "\n"
-                        + "No such uniform exists in program: " + std::string(label_buffer)
-                        + "\n" + std::string(80, '!')
-                    );
-                }
-                else
-                {
-                    Log::record_log(
-                        std::string(80, '!') +
-                        "Problem when requesting uniform: \"" + name + "\"\n" +
-                        "Check that there is an active program and that it has been"
-                        "correctly Initialized" +
-                        std::string(80, '!')
-                    );
-                }
+                    "\"" + string(name.name) + "\"" << std::endl;
+
+                char label_buffer[100];
+                GLsizei buff_size;
+                glGetObjectLabel(GL_PROGRAM, programID, 100, &buff_size, label_buffer);
+
+                Log::record_log(
+                    std::string(80, '!') + "\nFailed to find uniform: " + name.name + "\n"
+                    + "No such uniform exists in program: " + std::string(label_buffer)
+                    + "\n" + std::string(80, '!')
+                );
                exit(EXIT_FAILURE);
             }
 
             return loc;
         }
+//Find an optional uniform
+GLint Shading_Program::find_uniform(Uniform_Name name)
+{
+    uint mask = uniforms.size() - 1;
+    //The table is at most half full, a free slot ends every probe sequence
+    for(uint slot=name.hash & mask; !uniforms[slot].name.empty(); slot=(slot+1) & mask)
+        if(uniforms[slot].hash == name.hash && uniforms[slot].name == name.name)
+            return uniforms[slot].location;
+    return -1;
+}
+
+//──── Private Methods ───────────────────────────────────────────────────────────────────
+
+void Shading_Program::reflect_uniforms()
+{
+    GLint count;
+    glGetProgramInterfaceiv(programID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+    //Names of arrays are stored once per element plus twice for the array itself
+    vector<pair<string, GLint>> found;
+    for(GLint uniform=0; uniform<count; uniform++)
+    {
+        GLenum properties[] = {GL_NAME_LENGTH, GL_LOCATION, GL_ARRAY_SIZE};
+        GLint values[3];
+        glGetProgramResourceiv(programID, GL_UNIFORM, uniform, 3, properties, 3, NULL,
+            values);
+        //Members of uniform blocks have no location
+        if(values[1] == -1)
+            continue;
+        string name(values[0], '\0');
+        glGetProgramResourceName(programID, GL_UNIFORM, uniform, values[0], NULL,
+            &name[0]);
+        name.resize(values[0] - 1);
+        found.push_back({name, values[1]});
+
+        size_t bracket = name.rfind("[0]");
+        if(bracket == string::npos || bracket + 3 != name.size())
+            continue;
+        string base = name.substr(0, bracket);
+        found.push_back({base, values[1]});
+        for(GLint element=1; element<values[2]; element++)
+        {
+            string element_name = base + "[" + to_string(element) + "]";
+            found.push_back({element_name, glGetProgramResourceLocation(programID,
+                GL_UNIFORM, element_name.c_str())});
+        }
+    }
+
+    uint size = 1;
+    while(size < 2*found.size() + 1)
+        size *= 2;
+    uniforms.assign(size, {"", 0, -1});
+    for(auto &uniform : found)
+        insert_uniform(uniform.first, uniform.second);
+}
+
+void Shading_Program::insert_uniform(const string &name, GLint location)
+{
+    uint32_t hash = Uniform_Name::hash_name(name.c_str());
+    uint mask = uniforms.size() - 1;
+    uint slot = hash & mask;
+    while(!uniforms[slot].name.empty() && uniforms[slot].name != name)
+        slot = (slot + 1) & mask;
+    uniforms[slot] = {name, hash, location};
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                Compute_Program Class                                 *
+ *                                                                                      */
+//========================================================================================
+//Barriers that make buffer writes visible, one per way of reading a buffer
+#define BUFFER_BARRIERS (GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT | \
+    GL_UNIFORM_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT | \
+    GL_BUFFER_UPDATE_BARRIER_BIT | GL_TRANSFORM_FEEDBACK_BARRIER_BIT | \
+    GL_ATOMIC_COUNTER_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT)
+//Barriers that make image writes visible, one per way of reading a texture
+#define TEXTURE_BARRIERS (GL_TEXTURE_FETCH_BARRIER_BIT | \
+    GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | \
+    GL_FRAMEBUFFER_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT)
+
+GLbitfield Compute_Program::pending_barriers = 0;
+vector<GLuint> Compute_Program::written_buffers;
+vector<GLuint> Compute_Program::written_textures;
+
+/**
+ * @brief Find whether a resource is declared readonly in a GLSL source
+ *
+ * GL introspection does not expose memory qualifiers, so the declaration is looked up
+ * in the source.
+ *
+ * @param source The source, without comments
+ * @param declaration Regular expression matching the end of the declaration
+ * @return true If the qualifiers of the declaration include readonly
+*/
+bool static declared_readonly(const string &source, const string &declaration)
+{
+    smatch match;
+    if(!regex_search(source, match, regex(declaration)))
+        return false;
+    //The qualifiers start after the previous declaration
+    size_t end = match.position(0);
+    size_t start = source.find_last_of(";{}", end);
+    start = start == string::npos? 0 : start;
+    return regex_search(source.substr(start, end - start), regex("\\breadonly\\b"));
+}
+
+/**
+ * @brief Find whether a name is in a list of GL objects
+ *
+*/
+bool static contains(const vector<GLuint> &objects, GLuint name)
+{
+    return find(objects.begin(), objects.end(), name) != objects.end();
+}
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Compute_Program::Compute_Program(string cShader) :
+    Shading_Program("", "", "", "", "", cShader)
+{
+    //The shader was already read successfully to be compiled
+    string source;
+    ifstream input(cShader.c_str());
+    copy(istreambuf_iterator<char>(input),
+        istreambuf_iterator<char>(),
+        back_inserter(source));
+    input.close();
+
+    reflect(source);
+}
+
+//──── Private Methods ───────────────────────────────────────────────────────────────────
+
+void Compute_Program::reflect(const string &source)
+{
+    GLuint program = getProgramID();
+    GLint size[3];
+    glGetProgramiv(program, GL_COMPUTE_WORK_GROUP_SIZE, size);
+    work_group_size = uvec3(size[0], size[1], size[2]);
+
+    //Strip comments so that a commented readonly is not mistaken for a qualifier
+    regex comments("//[^\\n]*|/\\*[^*]*\\*+([^/*][^*]*\\*+)*/");
+    string code = regex_replace(source, comments, " ");
+    char name[256];
+
+    GLint block_count;
+    glGetProgramInterfaceiv(program, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES,
+        &block_count);
+    for(GLint block=0; block<block_count; block++)
+    {
+        glGetProgramResourceName(program, GL_SHADER_STORAGE_BLOCK, block, sizeof(name),
+            NULL, name);
+        GLenum property = GL_BUFFER_BINDING;
+        GLint binding;
+        glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, block, 1, &property,
+            1, NULL, &binding);
+        string declaration = "\\bbuffer\\s+" + string(name) + "\\b";
+        buffers.push_back({GLuint(binding), !declared_readonly(code, declaration)});
+    }
+
+    samples = false;
+    GLint uniform_count;
+    glGetProgramInterfaceiv(program, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniform_count);
+    for(GLint uniform=0; uniform<uniform_count; uniform++)
+    {
+        GLenum properties[] = {GL_TYPE, GL_LOCATION};
+        GLint values[2];
+        glGetProgramResourceiv(program, GL_UNIFORM, uniform, 2, properties, 2, NULL,
+            values);
+        GLenum type = values[0];
+        //Image types are a contiguous range of enums
+        if(type >= GL_IMAGE_1D && type <= GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY)
+        {
+            glGetProgramResourceName(program, GL_UNIFORM, uniform, sizeof(name), NULL,
+                name);
+            string image = string(name);
+            image = image.substr(0, image.find('['));
+            GLint unit;
+            glGetUniformiv(program, values[1], &unit);
+            string declaration = "\\b" + image + "\\s*(\\[[^\\]]*\\])?\\s*;";
+            images.push_back({GLuint(unit), !declared_readonly(code, declaration)});
+        }
+        //Sampler types are in five ranges, the uvec types sit between two of them
+        else if((type >= GL_SAMPLER_1D && type <= GL_SAMPLER_2D_SHADOW) ||
+            (type >= GL_SAMPLER_1D_ARRAY && type <= GL_SAMPLER_CUBE_SHADOW) ||
+            (type >= GL_INT_SAMPLER_1D && type <= GL_UNSIGNED_INT_SAMPLER_BUFFER) ||
+            (type >= GL_SAMPLER_2D_RECT && type <= GL_SAMPLER_2D_RECT_SHADOW) ||
+            (type >= GL_SAMPLER_2D_MULTISAMPLE &&
+                type <= GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY) ||
+            (type >= GL_SAMPLER_CUBE_MAP_ARRAY &&
+                type <= GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY))
+            samples = true;
+    }
+}
+
+void Compute_Program::wait_for_writes()
+{
+    //Bindings are read from the state cache, querying them would stall the driver
+    GL_State &state = GL_State::current();
+    GLbitfield bits = 0;
+    for(Compute_Resource &resource : buffers)
+    {
+        GLuint buffer = state.getBufferBinding(GL_SHADER_STORAGE_BUFFER,
+            resource.binding);
+        if(contains(written_buffers, buffer))
+            bits |= GL_SHADER_STORAGE_BARRIER_BIT;
+    }
+    for(Compute_Resource &resource : images)
+        if(contains(written_textures, state.getImageBinding(resource.binding)))
+            bits |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    //Sampled textures are not tracked per unit, any written texture may be one of them
+    if(samples && !written_textures.empty())
+        bits |= GL_TEXTURE_FETCH_BARRIER_BIT;
+
+    barrier(bits);
+}
+
+void Compute_Program::record_writes()
+{
+    GL_State &state = GL_State::current();
+    for(Compute_Resource &resource : buffers)
+    {
+        if(!resource.written)
+            continue;
+        GLuint buffer = state.getBufferBinding(GL_SHADER_STORAGE_BUFFER,
+            resource.binding);
+        if(buffer == 0)
+            continue;
+        if(!contains(written_buffers, buffer))
+            written_buffers.push_back(buffer);
+        pending_barriers |= BUFFER_BARRIERS;
+    }
+    for(Compute_Resource &resource : images)
+    {
+        if(!resource.written)
+            continue;
+        GLuint texture = state.getImageBinding(resource.binding);
+        if(texture == 0)
+            continue;
+        if(!contains(written_textures, texture))
+            written_textures.push_back(texture);
+        pending_barriers |= TEXTURE_BARRIERS;
+    }
+}
+
+//──── Dispatching ───────────────────────────────────────────────────────────────────────
+
+void Compute_Program::dispatch(GLuint x, GLuint y, GLuint z)
+{
+    wait_for_writes();
+    glDispatchCompute(x, y, z);
+    record_writes();
+}
+
+void Compute_Program::dispatch_threads(GLuint x, GLuint y, GLuint z)
+{
+    uvec3 groups = (uvec3(x, y, z) + work_group_size - 1u)/work_group_size;
+    dispatch(groups.x, groups.y, groups.z);
+}
+
+void Compute_Program::dispatch_indirect(GLuint buffer, GLintptr offset)
+{
+    //The work group count itself may have been written by an earlier dispatch
+    if(contains(written_buffers, buffer))
+        barrier(GL_COMMAND_BARRIER_BIT);
+    GL_State::current().bind_buffer(GL_DISPATCH_INDIRECT_BUFFER, buffer);
+
+    wait_for_writes();
+    glDispatchComputeIndirect(offset);
+    record_writes();
+}
+
+void Compute_Program::barrier(GLbitfield bits)
+{
+    bits &= pending_barriers;
+    if(bits == 0)
+        return;
+
+    glMemoryBarrier(bits);
+    pending_barriers &= ~bits;
+    //Writes every kind of access has waited for no longer need to be tracked
+    if(!(pending_barriers & BUFFER_BARRIERS))
+        written_buffers.clear();
+    if(!(pending_barriers & TEXTURE_BARRIERS))
+        written_textures.clear();
+}
+#undef BUFFER_BARRIERS
+#undef TEXTURE_BARRIERS
 
 }//Closing bracket of Helios namespace
 //########################################################################################
\ No newline at end of file
@@ -17,6 +17,17 @@
 
 #include "Helios/System-Libraries.hpp"
 #include "Debugging.hpp"
+#include "Mesh-Cache.hpp"
+#include "Mesh-Simplifier.hpp"
+#include "Meshlets.hpp"
+#include "Material.hpp"
+#include "Buffer-Heap.hpp"
+#include "Instance-Buffer.hpp"
+#include "GL-State.hpp"
+
+#include <future>
+#include <atomic>
+#include <memory>
 //########################################################################################
 
 namespace Helios{
@@ -30,7 +41,123 @@ class Texture;
 class Mesh;
 class Shading_Program;
 class Shader;
+struct Mesh_Heap;
+
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Mesh Import Options                                 *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Options controlling how a Mesh is imported and laid out in GPU memory
+ *
+ * Flags can be combined with a bitwise or.
+ *
+ * - HELIOS_MESH_DEFAULT: One buffer per attribute (positions, normals, uvs)
+ * - HELIOS_MESH_INTERLEAVED: A single buffer of Interleaved_Vertex, plus the position
+ *   only stream used by Mesh::draw_positions()
+ * - HELIOS_MESH_QUANTIZED: Positions are stored as 16 bit normalized integers relative
+ *   to the bounding box, normals as GL_INT_2_10_10_10_REV and uvs as half floats
+ *   (16 bytes per vertex instead of 32). Shaders must apply the scale and offset
+ *   loaded by Mesh::load_to_program() to the positions
+ * - HELIOS_MESH_OPTIMIZE: Reorder triangles for vertex cache locality and reduced
+ *   overdraw, and vertices in order of first use, when the mesh is imported
+ * - HELIOS_MESH_LOD: Generate simplified levels of detail on a worker thread after the
+ *   import, see Mesh::select_lod() and Mesh::draw_lod()
+ * - HELIOS_MESH_MESHLETS: Split the mesh into meshlets with culling data at import, see
+ *   Mesh::draw_meshlets() and Mesh::bind_meshlets()
+ * - HELIOS_MESH_CREASE_NORMALS: When the file has no normals, the generated ones are
+ *   only smoothed across faces within HELIOS_CREASE_ANGLE of each other
+ * - HELIOS_MESH_SHARED_BUFFERS: Vertices and indices are sub-allocated from large
+ *   buffers shared with the other meshes of the same layout, which also share their
+ *   VAO. Switching between those meshes only changes the base vertex and index offset
+ *   of the draws. Implies HELIOS_MESH_INTERLEAVED
+*/
+enum Mesh_Flags {HELIOS_MESH_DEFAULT = 0, HELIOS_MESH_INTERLEAVED = 1<<0,
+    HELIOS_MESH_QUANTIZED = 1<<1, HELIOS_MESH_OPTIMIZE = 1<<2, HELIOS_MESH_LOD = 1<<3,
+    HELIOS_MESH_MESHLETS = 1<<4, HELIOS_MESH_CREASE_NORMALS = 1<<5,
+    HELIOS_MESH_SHARED_BUFFERS = 1<<6};
+
+/**
+ * @brief Size in bytes of the vertex buffer of a page of shared mesh buffers
+ *
+*/
+#define HELIOS_MESH_HEAP_VERTEX_SIZE (64u<<20)
+/**
+ * @brief Size in bytes of the index buffer of a page of shared mesh buffers
+ *
+*/
+#define HELIOS_MESH_HEAP_INDEX_SIZE (32u<<20)
+
+/**
+ * @brief Layout of a vertex in an interleaved (array of structures) vertex buffer
+ *
+*/
+struct Interleaved_Vertex
+{
+    glm::vec3 position; //!< Vertex position
+    glm::vec3 normal;   //!< Vertex normal
+    glm::vec2 uv;       //!< Texture coordinate
+};
+
+/**
+ * @brief Layout of a vertex in an interleaved vertex buffer of a quantized mesh
+ *
+*/
+struct Quantized_Vertex
+{
+    GLushort position[4];   //!< Normalized position inside the bounding box (w unused)
+    GLuint normal;          //!< Normal packed as GL_INT_2_10_10_10_REV
+    GLhalf uv[2];           //!< Half precision texture coordinate
+};
 
+/**
+ * @brief Range of the index buffer of a mesh drawn for one level of detail
+ *
+*/
+struct Mesh_LOD
+{
+    uint32_t first_index;   //!< Offset in indices of the level in the index buffer
+    uint32_t index_count;   //!< Number of indices of the level
+    float error;            //!< Object space distance between the level and the mesh
+};
+
+/**
+ * @brief Name of a uniform, hashed once so that looking it up does not allocate
+ *
+ * String literals convert to it implicitly, names declared constexpr are hashed at
+ * compile time:
+ *
+ * @code
+ * static constexpr Uniform_Name view_uniform("view_m");
+ * program->load_uniform(view, view_uniform);
+ * @endcode
+ *
+ * It only points to the characters of the name, which must outlive it.
+*/
+struct Uniform_Name
+{
+    const char *name;   //!< Null terminated name
+    uint32_t hash;      //!< FNV-1a hash of the name
+
+    /**
+     * @brief Hash a null terminated name with FNV-1a
+     *
+    */
+    static constexpr uint32_t hash_name(const char *name)
+    {
+        uint32_t hash = 2166136261u;
+        for(; *name != '\0'; name++)
+            hash = (hash ^ uint8_t(*name))*16777619u;
+        return hash;
+    }
+
+    constexpr Uniform_Name(const char *uniform) : name(uniform), hash(hash_name(uniform))
+    {}
+    Uniform_Name(const std::string &uniform) : Uniform_Name(uniform.c_str()) {}
+};
 //########################################################################################
 
 //========================================================================================
@@ -81,13 +208,20 @@ class Texture
          * @param uniform The label of the uniform in the shader
          * @param texture_unit The texture unit to which to bind the texture
         */
-        void load_to_program(Shading_Program *program, std::string uniform,
+        void load_to_program(Shading_Program *program, Uniform_Name uniform,
             GLuint texture_unit);
         /**
          * @brief Draw this image as is to the screen
          *
         */
         void inline draw(){glDrawArrays(GL_TRIANGLE_STRIP, 0, 6);}
+        /**
+         * @brief Bind the texture to a texture unit, without touching any program
+         *
+         * @param texture_unit The texture unit to which to bind the texture
+        */
+        void inline bind(GLuint texture_unit)
+        {GL_State::current().bind_texture(target, textureID, texture_unit);}
 };
 
 /**
@@ -121,7 +255,7 @@ class Image3D : public Texture
          * @param texture_unit the texture unit in the context to which to bind the
          *        texture
         */
-        void inline load_to_program(Shading_Program *program, std::string uniform,
+        void inline load_to_program(Shading_Program *program, Uniform_Name uniform,
             GLuint texture_unit)
         {Texture::load_to_program(program, uniform, texture_unit);}
         /**
@@ -141,7 +275,7 @@ class Image3D : public Texture
         */
         void inline setLabel(std::string label)
         {
-            glBindTexture(target, textureID);
+            GL_State::current().bind_texture(target, textureID);
             glObjectLabel(GL_TEXTURE, textureID, -1, ("\""+label+"\"").c_str());
         }
 };
@@ -149,21 +283,160 @@ class Image3D : public Texture
  * @brief Class to wrap a generic 3D mesh
  *
 */
+class Camera;
+class Mesh_Loader;
+class Asset_Registry;
+class Draw_Batch;
+class Culling_Pass;
 class Mesh
 {
+    friend class Mesh_Loader;
+    friend class Draw_Batch;
+    friend class Culling_Pass;
 
 //──── Private Members ───────────────────────────────────────────────────────────────────
 
     private:
+        //Enumerators used to index through the buffers[] array
+        enum {MESH_VERTEX_BUFFER=0, MESH_NORMAL_BUFFER, MESH_UV_BUFFER,
+            MESH_INDICES_BUFFER, MESH_INTERLEAVED_BUFFER, MESH_MESHLET_BUFFER,
+            MESH_BUFFER_COUNT};
 
-        GLuint VAO;         //!< Vertex array object
-        GLuint buffers[4];  //!< VBO identifiers
+        GLuint VAO;                         //!< Vertex array object
+        GLuint position_VAO;                //!< VAO reading only the position stream
+        GLuint buffers[MESH_BUFFER_COUNT];  //!< VBO identifiers
+        uint flags;                         //!< Mesh_Flags the mesh was created with
 
         std::vector<glm::vec3> vertices;    //!< Array of vertices of the mesh
         std::vector<glm::vec3> normals;     //!< Array of normals of the mesh
         std::vector<glm::vec2> uvs;         //!< Array of texture coordinates of the mesh
         std::vector<uint> indices;          //!< Array of indices for per element indexing
 
+        GLenum index_type;      //!< Type of the uploaded indices (e.g GL_UNSIGNED_SHORT)
+        GLsizei index_count;    //!< Number of indices of the full resolution mesh
+        uint vertex_count;      //!< Number of uploaded vertices
+
+        std::vector<Mesh_LOD> lods; //!< Levels of detail, the first one is the full mesh
+        std::vector<Meshlet> meshlets;  //!< Clusters of the full resolution mesh
+        std::vector<Submesh> submeshes; //!< Material ranges of the full resolution mesh
+        std::vector<Material> materials;    //!< Materials referenced by the submeshes
+        std::vector<std::shared_ptr<Texture>> textures; //!< Diffuse maps of the materials
+        Asset_Registry *assets;     //!< Registry of the textures, NULL for the default
+        std::vector<int> material_textures; //!< Texture of every material, -1 if none
+        std::future<std::vector<Simplified_Mesh>> pending_lods; //!< Levels being generated
+        std::string source_path;    //!< File the mesh was imported from
+        std::atomic<GLsync> upload_fence;   //!< Signals the end of an asynchronous load
+        std::atomic<bool> failed;   //!< Whether an asynchronous import failed
+
+        Mesh_Heap *heap;            //!< Shared buffers holding the mesh, NULL if it has its own
+        size_t heap_vertex_offset;  //!< Offset in bytes of the vertices in the heap
+        size_t heap_vertex_size;    //!< Size in bytes of the vertex range in the heap
+        size_t heap_index_offset;   //!< Offset in bytes of the indices in the heap
+        size_t heap_index_size;     //!< Size in bytes of the index range in the heap
+        GLint base_vertex;          //!< Added to every index when drawing
+        GLintptr index_start;       //!< Offset in bytes of the first index in its buffer
+        //! Incremented whenever the levels or the buffer ranges of the mesh change, draws
+        //! recorded with an older revision must be described again
+        uint revision;
+
+        //Tag selecting the constructor used by Mesh_Loader
+        struct Deferred_Load {};
+        /**
+         * @brief Construct a mesh without data, filled later by Mesh_Loader
+         *
+        */
+        Mesh(Deferred_Load);
+
+        glm::vec3 bounds_min;   //!< Minimum corner of the axis aligned bounding box
+        glm::vec3 bounds_max;   //!< Maximum corner of the axis aligned bounding box
+        glm::vec3 sphere_center;    //!< Center of the bounding sphere
+        float sphere_radius;        //!< Radius of the bounding sphere
+
+        /**
+         * @brief Describe the CPU side data of the mesh as ready to upload blocks
+         *
+         * Data that has to be converted to match the mesh flags (e.g interleaved
+         * vertices) is written to new arrays in storage.
+         *
+         * @param mesh_indices Indices of every level of the mesh
+         * @param mesh_lods Ranges of the levels in mesh_indices
+         * @param storage Owner of the converted data, must outlive the blocks
+         * @return std::vector<Mesh_Block> Blocks pointing to the mesh arrays
+        */
+        std::vector<Mesh_Block> create_blocks(const std::vector<uint> &mesh_indices,
+            const std::vector<Mesh_LOD> &mesh_lods,
+            std::vector<std::vector<char>> &storage);
+        /**
+         * @brief Import a mesh file, or its cache, and fill the buffers of the mesh
+         *
+         * Only creates buffers, so it can run on any context sharing objects with the
+         * one that draws the mesh.
+         *
+         * @param file_path Path to a wavefront (.obj) file
+         * @param mesh_flags Combination of Mesh_Flags
+         * @return true If the mesh was imported
+         * @return false If the file could not be read, no buffers are created
+        */
+        bool load_buffers(std::string file_path, uint mesh_flags);
+        /**
+         * @brief Create the buffers of the mesh and upload the blocks to them
+         *
+         * vertex_count must be set before calling this function.
+         *
+         * @param blocks The data of the mesh
+         * @param name Base name used to label the OpenGL objects
+        */
+        void upload_blocks(std::vector<Mesh_Block> &blocks, std::string name);
+        /**
+         * @brief Create the VAOs of the mesh, they only exist in the current context
+         *
+        */
+        void create_vertex_arrays();
+        /**
+         * @brief Create the VAOs of an asynchronously loaded mesh once it is uploaded
+         *
+         * Every draw path goes through it, so it also picks up finished levels of detail.
+         *
+         * @return true If the mesh can be drawn
+        */
+        bool make_resident();
+        /**
+         * @brief Write the blocks of the mesh to the cache of its source file
+         *
+         * @param blocks The data of the mesh
+         * @param total_indices Number of indices of every level of the mesh
+        */
+        void store_in_cache(std::vector<Mesh_Block> &blocks, size_t total_indices);
+        /**
+         * @brief Upload the levels of detail once the worker generating them is done
+         *
+         * Appends the levels to the index buffer and increments the revision of the
+         * mesh. The worker already wrote them to the cache.
+        */
+        void poll_lods();
+        /**
+         * @brief Bind the VAO and the vertex buffers of the mesh for drawing
+         *
+        */
+        void bind_vertex_buffers();
+        /**
+         * @brief Acquire the diffuse textures of the materials from the asset registry
+         *
+         * Meshes created without a registry share a default one, so an image used by
+         * several meshes is uploaded once either way. Textures that cannot be found are
+         * logged and the material is left untextured.
+        */
+        void load_textures();
+        /**
+         * @brief Move the vertices and indices of the mesh to the shared buffers
+         *
+         * Releases the ranges the mesh held before, if any. A new page of buffers is
+         * created when no existing one has room for the mesh.
+         *
+         * @param blocks The data of the mesh, its interleaved and index blocks are used
+        */
+        void place_in_heap(std::vector<Mesh_Block> &blocks);
+
     public:
 
 //──── Constructors and Destructors ──────────────────────────────────────────────────────
@@ -176,29 +449,211 @@ class Mesh
         /**
          * @brief Construct a new Mesh object
          *
+         * The imported mesh is stored in a binary cache (see Mesh_Cache). Later
+         * constructions from the same unchanged file upload the cached data directly,
+         * in which case the CPU side vertex arrays of the mesh are left empty. Only the
+         * .obj file is checked, edited material libraries are not picked up until the
+         * .obj file changes.
+         *
          * @param string path to a wavefront (.obj) file
+         * @param flags Combination of Mesh_Flags
+         * @param registry Registry the material textures are acquired from, NULL to
+         *        share them with the other meshes created without one
         */
-        Mesh(std:: string file_path);
+        Mesh(std:: string file_path, uint flags = HELIOS_MESH_DEFAULT,
+            Asset_Registry *registry = NULL);
         /**
          * @brief Destroy the Mesh object
          *
         */
         ~Mesh();
 
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        ///@{
+        /**
+         * @brief Get the corners of the axis aligned bounding box of the mesh
+         *
+        */
+        glm::vec3 inline getBoundsMin(){return bounds_min;}
+        glm::vec3 inline getBoundsMax(){return bounds_max;}
+        ///@}
+        ///@{
+        /**
+         * @brief Get the bounding sphere of the mesh, in object space
+         *
+         * Transform it with transform_sphere() before culling an instance of the mesh.
+        */
+        glm::vec3 inline getSphereCenter(){return sphere_center;}
+        float inline getSphereRadius(){return sphere_radius;}
+        ///@}
+        /**
+         * @brief Get the number of indices drawn by draw()
+         *
+        */
+        GLsizei inline getIndexCount(){return index_count;}
+        /**
+         * @brief Whether the mesh can be drawn, always true unless made by Mesh_Loader
+         *
+        */
+        bool inline is_resident(){return make_resident();}
+        /**
+         * @brief Whether Mesh_Loader could not import the file, the mesh is never drawn
+         *
+        */
+        bool inline has_failed(){return failed;}
+        /**
+         * @brief Get the number of levels of detail available, 1 until they are ready
+         *
+        */
+        uint inline getLODCount(){return lods.size();}
+        /**
+         * @brief Get the number of meshlets of the mesh, 0 if it was not split
+         *
+        */
+        uint inline getMeshletCount(){return meshlets.size();}
+        /**
+         * @brief Get the number of material ranges drawn by draw_materials()
+         *
+        */
+        uint inline getSubmeshCount(){return submeshes.size();}
+        /**
+         * @brief Get the occupancy of the buffers shared by HELIOS_MESH_SHARED_BUFFERS
+         *
+         * The statistics of every page of buffers are added up, the largest free range
+         * is the largest one of any page.
+         *
+         * @param vertex_stats Where to store the statistics of the vertex buffers
+         * @param index_stats Where to store the statistics of the index buffers
+        */
+        static void getSharedBufferStats(Heap_Stats &vertex_stats, Heap_Stats &index_stats);
+        /**
+         * @brief Get the material of a range drawn by draw_materials()
+         *
+         * @param submesh Index of the range, in draw order
+        */
+        const Material inline &getMaterial(uint submesh)
+        {return materials[submeshes[submesh].material];}
+
 //──── GPU related methods ───────────────────────────────────────────────────────────────
 
         /**
          * @brief Draw the mesh
          *
+         * Like every draw method, does nothing until the mesh is resident.
         */
         void draw();
+        /**
+         * @brief Draw the mesh reading only vertex positions (attribute location 0)
+         *
+         * Meant for depth only passes such as shadow maps, it fetches 12 bytes per vertex
+         * regardless of the layout of the other attributes, except for meshes in shared
+         * buffers, which only store interleaved vertices.
+        */
+        void draw_positions();
+        /**
+         * @brief Draw one level of detail of the mesh
+         *
+         * @param lod Level to draw, 0 is the full resolution mesh
+        */
+        void draw_lod(uint lod);
+        /**
+         * @brief Draw a range of instances of the mesh with a single call
+         *
+         * The instances are bound to HELIOS_INSTANCE_BINDING and the draw starts at
+         * base instance first, Instanced-Vertex.glsl reads the data of an instance at
+         * gl_BaseInstanceARB + gl_InstanceID.
+         *
+         * @param instances The data of the instances
+         * @param first Index of the first instance to draw
+         * @param count Number of instances to draw, clipped to the buffer capacity
+         * @param lod Level of detail to draw (see select_lod())
+        */
+        void draw_instanced(Instance_Buffer &instances, uint first, uint count,
+            uint lod = 0);
+        /**
+         * @brief Pick the coarsest level of detail whose error is not visible
+         *
+         * The error of every level is projected to pixels at the distance of the bounding
+         * sphere of the mesh with the projection of the camera.
+         *
+         * @param camera The camera the mesh is drawn from
+         * @param model Model matrix of the drawn instance
+         * @param pixel_error Largest acceptable error in pixels
+         * @return uint The level to pass to draw_lod()
+        */
+        uint select_lod(Camera &camera, const glm::mat4 &model, float pixel_error = 1.f);
+        /**
+         * @brief Draw the meshlets that may be visible from a camera
+         *
+         * Meshlets outside the view frustum or facing away from the camera are culled on
+         * the CPU and the rest are drawn with a single glMultiDrawElements call. Meshes
+         * without meshlets are drawn whole.
+         *
+         * @param camera The camera the mesh is drawn from
+         * @param model Model matrix of the drawn instance
+         * @return uint The number of meshlets drawn
+        */
+        uint draw_meshlets(Camera &camera, const glm::mat4 &model);
+        /**
+         * @brief Draw the mesh one material at a time
+         *
+         * Faces are grouped per material at import, in an order that binds every
+         * diffuse texture once. Before each range the "material_diffuse",
+         * "material_specular", "material_shininess", "material_opacity" and
+         * "use_diffuse_map" uniforms are set and the "diffuse_map" sampler reads
+         * texture_unit. Uniforms the program does not declare are ignored.
+         *
+         * @param program The program drawing the mesh
+         * @param texture_unit Texture unit to which the diffuse maps are bound
+        */
+        void draw_materials(Shading_Program *program, GLuint texture_unit = 0);
+        /**
+         * @brief Bind the meshlet array to a shader storage buffer binding point
+         *
+         * The buffer holds one std430 {vec4 sphere; vec4 cone; uvec4 range;} per
+         * Meshlet, for culling in compute passes.
+         *
+         * @param binding Index of the binding point
+        */
+        void inline bind_meshlets(GLuint binding)
+        {
+            GL_State::current().bind_buffer_base(GL_SHADER_STORAGE_BUFFER, binding,
+                buffers[MESH_MESHLET_BUFFER]);
+        }
+        /**
+         * @brief Load the uniforms needed to read the positions of the mesh
+         *
+         * Sets "position_scale" and "position_offset", the object space position of a
+         * vertex is position*position_scale + position_offset. For meshes that are not
+         * quantized they are 1 and 0. Programs that do not declare them are skipped,
+         * they can only draw meshes that are not quantized.
+         *
+         * @param program The program that will draw the mesh
+        */
+        void load_to_program(Shading_Program *program);
 
         /**
          * @brief Load mesh information from a wavefront file
          *
+         * Corners sharing the same position, texture coordinate and normal are merged
+         * into a single vertex and the faces are stored as indices. Faces are grouped
+         * by the material they use, read from the "mtllib" libraries of the file.
+         *
          * @param file_path Path to the .obj file
+         * @return true If the file was loaded
+         * @return false If the file is missing or malformed, the error is logged
+        */
+        bool load_from_obj(std::string file_path);
+        /**
+         * @brief Reorder the triangles and vertices of the mesh for rendering speed
+         *
+         * Runs the vertex cache, overdraw and vertex fetch passes of Mesh-Optimizer and
+         * logs the ACMR and ATVR before and after. Triangles never leave the material
+         * range they belong to.
+         *
         */
-        void load_from_obj(std::string file_path);
+        void optimize();
 };
 /**
  * @ingroup Helios
@@ -278,16 +733,51 @@ class Shader
         */
         void inline detachFrom(GLuint program){glDetachShader(program, shaderID);}
 };
+/**
+ * @brief Directory in which linked program binaries are cached
+ *
+*/
+#define HELIOS_PROGRAM_CACHE_DIRECTORY "cache/programs"
 /**
  * @brief Class to wrap OpenGL shading programs
  *
+ * Linked programs are cached in HELIOS_PROGRAM_CACHE_DIRECTORY under a hash of their
+ * sources and of the vendor, renderer and version strings of the driver. Later runs load
+ * the binary instead of compiling, and editing a shader or updating the driver changes
+ * the hash so stale binaries are never used.
 */
 class Shading_Program
 {
 //──── Private Members ───────────────────────────────────────────────────────────────────
 
     private:
+        /**
+         * @brief Entry of the table of uniform locations
+         *
+        */
+        struct Uniform_Slot
+        {
+            std::string name;   //!< Name of the uniform, empty if the slot is free
+            uint32_t hash;      //!< Uniform_Name hash of the name
+            GLint location;     //!< Location of the uniform
+        };
+
         GLuint programID;           //!< OpenGL generated identifier
+        //! Open addressing table of the active uniforms, its size is a power of 2
+        std::vector<Uniform_Slot> uniforms;
+
+        /**
+         * @brief Fill the table of uniform locations from the linked program
+         *
+         * Arrays are found by their name, the name of their first element and the
+         * names of every element.
+        */
+        void reflect_uniforms();
+        /**
+         * @brief Add a uniform to the table
+         *
+        */
+        void insert_uniform(const std::string &name, GLint location);
 
     public:
 
@@ -303,7 +793,10 @@ class Shading_Program
          * files through the pattern <Descriptive Name>-<shader type>.glsl
          * e.g MyShaders-vertex.glsl.
          *
-         * @param vShader Path of the source file of a vertex shader (mandatory)
+         * A compute program is created by leaving every path but the compute shader
+         * empty, it is labeled after the compute shader instead.
+         *
+         * @param vShader Path of the source file of a vertex shader ("" if compute)
          *
          * @param tcShader Path of the source file of a tessellation control shader or ""
          *
@@ -311,7 +804,7 @@ class Shading_Program
          *
          * @param gShader Path of the source file of a geometry shader or ""
          *
-         * @param Path of the source file of a fragment shader (mandatory)
+         * @param fShader Path of the source file of a fragment shader ("" if compute)
          *
          * @param cShader Path of the source file of a compute shader or ""
          *
@@ -338,7 +831,7 @@ class Shading_Program
          * @brief use the current program
          *
         */
-        void inline use(){glUseProgram(programID);}
+        void inline use(){GL_State::current().use_program(programID);}
         /**
          * @brief Set the program's OpenGL label
          *
@@ -357,59 +850,192 @@ class Shading_Program
 //──── Uniform Functions ─────────────────────────────────────────────────────────────────
 
         /**
-         * @brief Get the location of the uniform labeled <name> in the current program
+         * @brief Get the location of the uniform labeled <name> in the program, exits
+         * if there is no such active uniform
+         *
+         * Locations are read from a table filled when the program is linked, the
+         * driver is not queried.
          *
          * @param name The string representing the uniform to be found
-         * @return GLint The location of the uniform in the current shading program
+         * @return GLint The location of the uniform in the shading program
+        */
+        GLint get_uniform_location(Uniform_Name name);
+        /**
+         * @brief Find the location of an optional uniform
+         *
+         * @param name Name of the uniform
+         * @return GLint The location, -1 if the program has no such active uniform
         */
-        GLint get_uniform_location(std::string name);
+        GLint find_uniform(Uniform_Name name);
         /**
          * @name Uniform Loading Functions
          *
          * @brief Each of the following functions loads the values described in the first
          * parameter into the uniform labeled "name"
          *
+         * The program does not need to be current.
+         *
          * @param type the structure containing the info to load
          * @param name string describing the name of the uniform as it appears on the shaders
         */
         ///@{
-        void inline load_uniform(glm::mat4 matrix, std::string name)
+        void inline load_uniform(glm::mat4 matrix, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniformMatrix4fv(loc, 1, GL_FALSE, value_ptr(matrix));
+            glProgramUniformMatrix4fv(programID, loc, 1, GL_FALSE, value_ptr(matrix));
         }
 
-        void inline load_uniform(glm::vec4 vector, std::string name)
+        void inline load_uniform(glm::vec4 vector, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniform4fv(loc, 1, (GLfloat*)&(vector));
+            glProgramUniform4fv(programID, loc, 1, (GLfloat*)&(vector));
         }
 
-        void inline load_uniform(glm::vec3 vector, std::string name)
+        void inline load_uniform(glm::vec3 vector, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniform3fv(loc, 1, (GLfloat*)&(vector));
+            glProgramUniform3fv(programID, loc, 1, (GLfloat*)&(vector));
         }
 
-        void inline load_uniform(float num, std::string name)
+        void inline load_uniform(float num, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniform1f(loc, num);
+            glProgramUniform1f(programID, loc, num);
         }
 
-        void inline load_uniform(double num, std::string name)
+        void inline load_uniform(double num, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniform1f(loc, num);
+            glProgramUniform1f(programID, loc, num);
         }
 
-        void inline load_uniform(int num, std::string name)
+        void inline load_uniform(int num, Uniform_Name name)
         {
             GLint loc = get_uniform_location(name);
-            glUniform1i(loc, num);
+            glProgramUniform1i(programID, loc, num);
         }
         ///@}
 };
+/**
+ * @ingroup Helios
+ *
+ * @brief A program made of a single compute shader
+ *
+ * The work group size, the shader storage blocks and the images of the program are
+ * reflected once it is linked. Blocks and images not declared readonly in the source
+ * are considered written by every dispatch. The buffers and textures bound to them at
+ * dispatch time are remembered, and the next dispatch reading one of them, or a call to
+ * barrier(), issues only the glMemoryBarrier bits that are still needed.
+ *
+ * @code
+ * Compute_Program skinning("Skinning-Compute.glsl");
+ * skinning.use();
+ * skinning.dispatch_threads(vertex_count);
+ * //Vertices are read as attributes next
+ * Compute_Program::barrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+ * @endcode
+*/
+class Compute_Program : public Shading_Program
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief A shader storage block or image of the program
+         *
+        */
+        struct Compute_Resource
+        {
+            GLuint binding; //!< Binding point of the block or image unit of the image
+            bool written;   //!< Whether the source lacks the readonly qualifier
+        };
+
+        glm::uvec3 work_group_size;             //!< Declared local size
+        std::vector<Compute_Resource> buffers;  //!< Shader storage blocks
+        std::vector<Compute_Resource> images;   //!< Image uniforms
+        bool samples;                           //!< Whether it has samplers
+
+        static GLbitfield pending_barriers;             //!< Bits not issued since a write
+        static std::vector<GLuint> written_buffers;     //!< Buffers written by dispatches
+        static std::vector<GLuint> written_textures;    //!< Textures written likewise
+
+        /**
+         * @brief Find the resources of the linked program
+         *
+         * @param source Source of the compute shader, used to find readonly resources
+        */
+        void reflect(const std::string &source);
+        /**
+         * @brief Issue the barriers needed before reading what earlier dispatches wrote
+         *
+        */
+        void wait_for_writes();
+        /**
+         * @brief Remember the resources written by the dispatch that was just issued
+         *
+        */
+        void record_writes();
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Compile and link a compute program
+         *
+         * @param cShader Path of the source file of the compute shader
+        */
+        Compute_Program(std::string cShader);
+
+//──── Setters and Getters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the local size declared by the shader
+         *
+        */
+        glm::uvec3 inline getWorkGroupSize(){return work_group_size;}
+
+//──── Dispatching ───────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Run the program, it must be the current program
+         *
+         * @param x Number of work groups along x
+         * @param y Number of work groups along y
+         * @param z Number of work groups along z
+        */
+        void dispatch(GLuint x, GLuint y = 1, GLuint z = 1);
+        /**
+         * @brief Run at least one invocation per element of a grid, it must be the
+         * current program
+         *
+         * Shaders must skip the invocations past the grid when its size is not a
+         * multiple of the work group size.
+         *
+         * @param x Number of elements along x
+         * @param y Number of elements along y
+         * @param z Number of elements along z
+        */
+        void dispatch_threads(GLuint x, GLuint y = 1, GLuint z = 1);
+        /**
+         * @brief Run the program with a work group count read from a buffer, it must be
+         * the current program
+         *
+         * @param buffer Buffer holding three GLuint work group counts
+         * @param offset Offset in bytes of the counts in the buffer
+        */
+        void dispatch_indirect(GLuint buffer, GLintptr offset = 0);
+        /**
+         * @brief Make the writes of earlier dispatches visible to a kind of access
+         *
+         * Only the bits that were not issued since the last write are issued, nothing
+         * is issued when no dispatch wrote anything.
+         *
+         * @param bits glMemoryBarrier bits of the accesses that follow (e.g
+         *        GL_COMMAND_BARRIER_BIT before drawing commands written by a dispatch)
+        */
+        static void barrier(GLbitfield bits);
+};
 }//Close helios namespace
 //########################################################################################
 
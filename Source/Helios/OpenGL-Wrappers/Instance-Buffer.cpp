@@ -0,0 +1,62 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the per instance data of instanced mesh draws
+ *
+ * @file Instance-Buffer.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Instance-Buffer.hpp"
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Instance Buffer Class                                *
+ *                                                                                      */
+//========================================================================================
+namespace Helios{
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Instance_Buffer::Instance_Buffer(uint instance_capacity, string label)
+{
+    capacity = instance_capacity;
+    vector<Mesh_Instance> initial(capacity, {mat4(1), vec4(1)});
+
+    glGenBuffers(1, &buffer);
+    GL_State::current().bind_buffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glObjectLabel(GL_BUFFER, buffer, -1, ("\"" + label + "\"").c_str());
+    glBufferData(GL_SHADER_STORAGE_BUFFER, capacity*sizeof(Mesh_Instance),
+        initial.data(), GL_DYNAMIC_DRAW);
+}
+
+Instance_Buffer::~Instance_Buffer()
+{
+    GL_State::delete_buffers(1, &buffer);
+}
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+void Instance_Buffer::update(uint first, const Mesh_Instance *instances, uint count)
+{
+    if(first >= capacity)
+        return;
+    count = std::min(count, capacity - first);
+    GL_State::current().bind_buffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, first*sizeof(Mesh_Instance),
+        count*sizeof(Mesh_Instance), instances);
+}
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,126 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the per instance data of instanced mesh draws
+ *
+ * @file Instance-Buffer.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "GL-State.hpp"
+//########################################################################################
+
+/**
+ * @brief Shader storage binding point of the instances read by Instanced-Vertex.glsl
+ *
+*/
+#define HELIOS_INSTANCE_BINDING 1
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Structure Declarations                              *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Data of one instance, as laid out in the std430 storage buffer
+ *
+*/
+struct Mesh_Instance
+{
+    glm::mat4 model;    //!< Model matrix of the instance
+    glm::vec4 color;    //!< Color multiplying the shading of the instance
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Storage buffer holding the instances drawn by Mesh::draw_instanced()
+ *
+ * The buffer has a fixed capacity. Instances are written by ranges, so a scene where
+ * only some instances move each frame (e.g a crowd walking through a static forest)
+ * only uploads those.
+*/
+class Instance_Buffer
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        GLuint buffer;  //!< The storage buffer
+        uint capacity;  //!< Number of instances the buffer can hold
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Create the buffer, every instance starts as an identity transform with a
+         * white color
+         *
+         * @param instance_capacity Number of instances the buffer can hold
+         * @param label OpenGL label of the buffer
+        */
+        Instance_Buffer(uint instance_capacity, std::string label = "Instance buffer");
+        /**
+         * @brief Delete the buffer
+         *
+        */
+        ~Instance_Buffer();
+
+        Instance_Buffer(const Instance_Buffer&) = delete;
+        Instance_Buffer &operator=(const Instance_Buffer&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of instances the buffer can hold
+         *
+        */
+        uint inline getCapacity(){return capacity;}
+
+//──── Other Functions ───────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Overwrite a range of instances
+         *
+         * Ranges that go past the capacity are clipped.
+         *
+         * @param first Index of the first instance to write
+         * @param instances The new data of the instances
+         * @param count Number of instances to write
+        */
+        void update(uint first, const Mesh_Instance *instances, uint count);
+        /**
+         * @brief Overwrite a range of instances
+         *
+         * @param first Index of the first instance to write
+         * @param instances The new data, one entry per instance
+        */
+        void inline update(uint first, const std::vector<Mesh_Instance> &instances)
+        {update(first, instances.data(), instances.size());}
+        /**
+         * @brief Bind the buffer to the binding read by Instanced-Vertex.glsl
+         *
+        */
+        void inline bind()
+        {
+            GL_State::current().bind_buffer_base(GL_SHADER_STORAGE_BUFFER,
+                HELIOS_INSTANCE_BINDING, buffer);
+        }
+};
+
+}//Close Helios namespace
+//########################################################################################
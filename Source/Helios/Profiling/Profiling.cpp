@@ -0,0 +1,131 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of GPU timing and benchmarking tools
+ *
+ * @file Profiling.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Profiling.hpp"
+
+using namespace std;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Time a number of draws of a mesh
+ *
+ * @param mesh The mesh to draw
+ * @param positions_only Whether to use Mesh::draw_positions() instead of Mesh::draw()
+ * @param iterations Number of draws
+ * @return double Total GPU time in milliseconds
+*/
+double static time_draws(Helios::Mesh &mesh, bool positions_only, int iterations)
+{
+    //Warm up caches and drivers before measuring
+    positions_only? mesh.draw_positions() : mesh.draw();
+    glFinish();
+
+    Helios::GPU_Timer timer;
+    timer.begin();
+    for(int i=0; i<iterations; i++)
+        positions_only? mesh.draw_positions() : mesh.draw();
+    timer.end();
+
+    return timer.elapsed_ms();
+}
+/**
+ * @brief Print and log one benchmark result
+ *
+ * @param label Name of the tested layout
+ * @param milliseconds Total GPU time of all iterations
+ * @param indices Number of indices processed per draw
+ * @param iterations Number of draws
+*/
+void static report(string label, double milliseconds, GLsizei indices, int iterations)
+{
+    double per_draw = milliseconds/iterations;
+    double throughput = double(indices)*iterations/(milliseconds*1e3);
+    string message = "\t" + label + ": " + to_string(per_draw) + " ms per draw, " +
+        to_string(throughput) + " M indices/s";
+
+    cout << message << endl;
+    Log::record_log(message);
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                    GPU Timer Class                                   *
+ *                                                                                      */
+//========================================================================================
+
+GPU_Timer::GPU_Timer()
+{
+    glGenQueries(1, &query);
+}
+
+GPU_Timer::~GPU_Timer()
+{
+    glDeleteQueries(1, &query);
+}
+
+//Read back the query result
+double GPU_Timer::elapsed_ms()
+{
+    GLuint64 nanoseconds = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+    return nanoseconds/1e6;
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                Function Implementations                              *
+ *                                                                                      */
+//========================================================================================
+
+//Compare mesh layouts
+void benchmark_mesh_layouts(string file_path, Shading_Program *program, int iterations)
+{
+    Log::record_log(string(80, '-'));
+    Log::record_log("Vertex layout benchmark: " + file_path + ", " +
+        to_string(iterations) + " draws per layout");
+    cout << "Vertex layout benchmark: " << file_path << endl;
+
+    program->use();
+    //Only vertex work is measured
+    GL_State::current().enable(GL_RASTERIZER_DISCARD);
+    {
+        Mesh split(file_path, HELIOS_MESH_DEFAULT);
+        double split_time = time_draws(split, false, iterations);
+        report("Split streams", split_time, split.getIndexCount(), iterations);
+
+        Mesh interleaved(file_path, HELIOS_MESH_INTERLEAVED);
+        double interleaved_time = time_draws(interleaved, false, iterations);
+        report("Interleaved", interleaved_time, interleaved.getIndexCount(), iterations);
+
+        double positions_time = time_draws(interleaved, true, iterations);
+        report("Positions only", positions_time, interleaved.getIndexCount(), iterations);
+    }
+    GL_State::current().disable(GL_RASTERIZER_DISCARD);
+
+    Log::record_log(string(80, '-'));
+}
+
+}//Closing bracket of Helios namespace
+//########################################################################################
@@ -0,0 +1,90 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of GPU timing and benchmarking tools
+ *
+ * @file Profiling.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Measure the GPU time taken by a sequence of OpenGL commands
+ *
+ * Wraps a GL_TIME_ELAPSED query, only one timer can be active at a time.
+*/
+class GPU_Timer
+{
+    private:
+        GLuint query; //!< OpenGL name of the query object
+
+    public:
+        /**
+         * @brief Create the query object
+         *
+        */
+        GPU_Timer();
+        /**
+         * @brief Delete the query object
+         *
+        */
+        ~GPU_Timer();
+
+        /**
+         * @brief Start timing the commands issued from now on
+         *
+        */
+        void inline begin(){glBeginQuery(GL_TIME_ELAPSED, query);}
+        /**
+         * @brief Stop timing
+         *
+        */
+        void inline end(){glEndQuery(GL_TIME_ELAPSED);}
+        /**
+         * @brief Get the time between begin() and end(), waits for the GPU to finish
+         *
+         * @return double Elapsed GPU time in milliseconds
+        */
+        double elapsed_ms();
+};
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Function Declarations                                *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Compare the vertex fetch throughput of the different Mesh layouts
+ *
+ * The mesh is loaded once per layout (split streams, interleaved and the position only
+ * stream) and drawn repeatedly with rasterization disabled, so the measured time is
+ * dominated by vertex fetching and shading. The results are printed and recorded in
+ * the log.
+ *
+ * @param file_path Path to the mesh to test, large meshes give more meaningful results
+ * @param program Program used to draw, its vertex inputs must follow the Mesh layout
+ * @param iterations Number of timed draws per layout
+*/
+void benchmark_mesh_layouts(std::string file_path, Shading_Program *program,
+    int iterations);
+
+}//Close Helios namespace
+//########################################################################################
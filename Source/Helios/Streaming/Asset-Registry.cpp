@@ -0,0 +1,171 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the registry sharing loaded assets between their users
+ *
+ * @file Asset-Registry.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Asset-Registry.hpp"
+
+#include <climits>
+#include <cstdlib>
+
+using namespace std;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Get the canonical form of a path
+ *
+ * @param file_path Path to a file
+ * @return string The absolute path without links, or the path itself if the file does
+ *         not exist (loading it will then report the error)
+*/
+string inline static canonical_path(const string &file_path)
+{
+    if(file_path.empty())
+        return file_path;
+    char canonical[PATH_MAX];
+    return realpath(file_path.c_str(), canonical)? string(canonical) : file_path;
+}
+/**
+ * @brief Remove the expired entries of a table
+ *
+ * @param table The table
+ * @return uint The number of live entries left
+*/
+template<typename Table>
+uint static remove_expired(Table &table)
+{
+    for(auto entry = table.begin(); entry != table.end();)
+    {
+        if(entry->second.expired())
+            entry = table.erase(entry);
+        else
+            ++entry;
+    }
+    return table.size();
+}
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Asset Registry Class                                 *
+ *                                                                                      */
+//========================================================================================
+namespace Helios{
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Asset_Registry::Asset_Registry(Mesh_Loader *mesh_loader)
+{
+    loader = mesh_loader;
+    hits = 0;
+    misses = 0;
+}
+
+Asset_Registry::~Asset_Registry()
+{
+    if(loader)
+        loader->wait();
+}
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+uint Asset_Registry::getHitCount()
+{
+    lock_guard<recursive_mutex> lock(registry_mutex);
+    return hits;
+}
+
+uint Asset_Registry::getMissCount()
+{
+    lock_guard<recursive_mutex> lock(registry_mutex);
+    return misses;
+}
+
+uint Asset_Registry::getLiveCount()
+{
+    lock_guard<recursive_mutex> lock(registry_mutex);
+    return remove_expired(meshes) + remove_expired(textures) + remove_expired(programs);
+}
+
+//──── Loading ───────────────────────────────────────────────────────────────────────────
+
+//Return the live asset of a key or create a new one
+template<typename Asset, typename Create>
+shared_ptr<Asset> Asset_Registry::acquire(Asset_Table<Asset> &table, const string &key,
+    Create create)
+{
+    //The lock is held while loading so concurrent requests do not load twice
+    lock_guard<recursive_mutex> lock(registry_mutex);
+    weak_ptr<Asset> &entry = table[key];
+    shared_ptr<Asset> asset = entry.lock();
+    if(asset)
+    {
+        hits++;
+        return asset;
+    }
+
+    misses++;
+    asset = create();
+    entry = asset;
+    return asset;
+}
+
+shared_ptr<Mesh> Asset_Registry::getMesh(string file_path, uint flags)
+{
+    string key = canonical_path(file_path) + "|" + to_string(flags);
+    return acquire(meshes, key, [this, &file_path, flags]()
+    {
+        if(loader)
+            return loader->load(file_path, flags, this);
+        return shared_ptr<Mesh>(new Mesh(file_path, flags, this));
+    });
+}
+
+shared_ptr<Texture> Asset_Registry::getTexture(string file_path, GLuint target)
+{
+    string key = canonical_path(file_path) + "|" + to_string(target);
+    return acquire(textures, key, [&file_path, target]()
+    {
+        return shared_ptr<Texture>(new Texture(file_path, target));
+    });
+}
+
+shared_ptr<Shading_Program> Asset_Registry::getProgram(string vShader, string tcShader,
+    string teShader, string gShader, string fShader, string cShader)
+{
+    string key = canonical_path(vShader) + "|" + canonical_path(tcShader) + "|" +
+        canonical_path(teShader) + "|" + canonical_path(gShader) + "|" +
+        canonical_path(fShader) + "|" + canonical_path(cShader);
+    return acquire(programs, key, [&]()
+    {
+        return shared_ptr<Shading_Program>(new Shading_Program(vShader, tcShader,
+            teShader, gShader, fShader, cShader));
+    });
+}
+
+void Asset_Registry::collect()
+{
+    lock_guard<recursive_mutex> lock(registry_mutex);
+    remove_expired(meshes);
+    remove_expired(textures);
+    remove_expired(programs);
+}
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,164 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the registry sharing loaded assets between their users
+ *
+ * @file Asset-Registry.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+#include "Mesh-Loader.hpp"
+
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Hands out shared handles to meshes, textures and programs loaded from files
+ *
+ * Assets are identified by the canonical path of their files and the parameters they
+ * are loaded with, so "Assets/a.obj" and "./Assets/a.obj" are the same mesh. The
+ * registry only keeps weak references: an asset is loaded the first time it is
+ * requested and its OpenGL objects are deleted when the last handle to it is dropped.
+ * Requesting it again after that loads it again.
+ *
+ * @code
+ * Helios::Asset_Registry assets(&loader);
+ * std::shared_ptr<Helios::Mesh> a = assets.getMesh("Assets/dragon.obj");
+ * std::shared_ptr<Helios::Mesh> b = assets.getMesh("./Assets/dragon.obj"); // a == b
+ * @endcode
+ *
+ * The diffuse textures of the meshes it loads are acquired from the registry as well, so
+ * materials of different meshes using the same image share one texture.
+ *
+ * The registry may be used from several threads, but assets are created on the calling
+ * thread, whose context must share objects with the one that draws them.
+*/
+class Asset_Registry
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief Weak references to the loaded assets of one kind
+         *
+        */
+        template<typename Asset>
+        using Asset_Table = std::unordered_map<std::string, std::weak_ptr<Asset>>;
+
+        Mesh_Loader *loader;                    //!< Loads meshes asynchronously if set
+        //! Guards the tables and counters, loading a mesh acquires its textures
+        std::recursive_mutex registry_mutex;
+        Asset_Table<Mesh> meshes;               //!< Meshes by path and Mesh_Flags
+        Asset_Table<Texture> textures;          //!< Textures by path and target
+        Asset_Table<Shading_Program> programs;  //!< Programs by the paths of the shaders
+        uint hits;      //!< Requests answered with an asset already loaded
+        uint misses;    //!< Requests that had to load their asset
+
+        /**
+         * @brief Find a live asset or create it
+         *
+         * @param table Table of the kind of asset
+         * @param key Identifier of the asset
+         * @param create Function loading the asset
+         * @return std::shared_ptr<Asset> The shared asset
+        */
+        template<typename Asset, typename Create>
+        std::shared_ptr<Asset> acquire(Asset_Table<Asset> &table, const std::string &key,
+            Create create);
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Construct an empty registry
+         *
+         * @param mesh_loader If not NULL, meshes are loaded by it in the background
+         *        (see Mesh_Loader), otherwise they are loaded before being returned
+        */
+        Asset_Registry(Mesh_Loader *mesh_loader = NULL);
+        /**
+         * @brief Wait for the meshes queued on the loader, they acquire textures from it
+         *
+        */
+        ~Asset_Registry();
+
+        Asset_Registry(const Asset_Registry&) = delete;
+        Asset_Registry &operator=(const Asset_Registry&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of requests served with an asset that was already loaded
+         *
+        */
+        uint getHitCount();
+        /**
+         * @brief Get the number of requests that loaded their asset
+         *
+        */
+        uint getMissCount();
+        /**
+         * @brief Get the number of assets currently in use
+         *
+        */
+        uint getLiveCount();
+
+//──── Loading ───────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get a mesh, loading it if nobody holds it
+         *
+         * @param file_path Path to a wavefront (.obj) file
+         * @param flags Combination of Mesh_Flags, each combination is a different mesh
+         * @return std::shared_ptr<Mesh> The shared mesh
+        */
+        std::shared_ptr<Mesh> getMesh(std::string file_path,
+            uint flags = HELIOS_MESH_DEFAULT);
+        /**
+         * @brief Get a texture, loading it if nobody holds it
+         *
+         * @param file_path Path to the image file
+         * @param target The OpenGL texture target (e.g GL_TEXTURE_2D)
+         * @return std::shared_ptr<Texture> The shared texture
+        */
+        std::shared_ptr<Texture> getTexture(std::string file_path, GLuint target);
+        /**
+         * @brief Get a program, compiling and linking it if nobody holds it
+         *
+         * Takes the same shader paths as the Shading_Program constructor.
+         *
+         * @return std::shared_ptr<Shading_Program> The shared program
+        */
+        std::shared_ptr<Shading_Program> getProgram(std::string vShader,
+            std::string tcShader, std::string teShader, std::string gShader,
+            std::string fShader, std::string cShader);
+        /**
+         * @brief Forget the assets that are no longer in use
+         *
+         * Expired entries are otherwise only replaced when their asset is requested
+         * again, this bounds the size of the tables when many assets come and go.
+        */
+        void collect();
+};
+
+}//Close Helios namespace
+//########################################################################################
@@ -0,0 +1,114 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of the asynchronous mesh loader
+ *
+ * @file Mesh-Loader.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Mesh-Loader.hpp"
+
+using namespace std;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Mesh Loader Class                                  *
+ *                                                                                      */
+//========================================================================================
+namespace Helios{
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Mesh_Loader::Mesh_Loader(GLFWwindow *shared_context)
+{
+    context = shared_context;
+    loading = false;
+    stop = false;
+    worker = thread(&Mesh_Loader::worker_loop, this);
+}
+
+Mesh_Loader::~Mesh_Loader()
+{
+    {
+        lock_guard<mutex> lock(jobs_mutex);
+        stop = true;
+    }
+    jobs_signal.notify_all();
+    worker.join();
+}
+
+//──── Loading ───────────────────────────────────────────────────────────────────────────
+
+shared_ptr<Mesh> Mesh_Loader::load(string file_path, uint flags, Asset_Registry *assets)
+{
+    shared_ptr<Mesh> mesh(new Mesh(Mesh::Deferred_Load()));
+    mesh->assets = assets;
+    {
+        lock_guard<mutex> lock(jobs_mutex);
+        jobs.push_back({mesh, file_path, flags});
+    }
+    jobs_signal.notify_one();
+    return mesh;
+}
+
+void Mesh_Loader::wait()
+{
+    unique_lock<mutex> lock(jobs_mutex);
+    idle_signal.wait(lock, [this](){return jobs.empty() && !loading;});
+}
+
+uint Mesh_Loader::getPendingCount()
+{
+    lock_guard<mutex> lock(jobs_mutex);
+    return jobs.size();
+}
+
+void Mesh_Loader::worker_loop()
+{
+    glfwMakeContextCurrent(context);
+    while(true)
+    {
+        unique_lock<mutex> lock(jobs_mutex);
+        jobs_signal.wait(lock, [this](){return stop || !jobs.empty();});
+        //Queued loads are finished before exiting
+        if(jobs.empty())
+            break;
+        Load_Job job = jobs.front();
+        jobs.pop_front();
+        loading = true;
+        lock.unlock();
+
+        //A failed mesh never gets a fence, drawing it keeps doing nothing
+        if(!job.mesh->load_buffers(job.file_path, job.flags))
+        {
+            job.mesh->failed = true;
+            Log::record_log("Could not load " + job.file_path + " asynchronously");
+        }
+        else
+        {
+            //The render thread creates the VAOs once the uploads are complete
+            GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+            job.mesh->upload_fence = fence;
+            Log::record_log("Loaded " + job.file_path + " asynchronously");
+        }
+
+        lock.lock();
+        loading = false;
+        lock.unlock();
+        idle_signal.notify_all();
+    }
+    glfwMakeContextCurrent(NULL);
+}
+//########################################################################################
+
+}//Helios namespace closing bracket
@@ -0,0 +1,129 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of the asynchronous mesh loader
+ *
+ * @file Mesh-Loader.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+//########################################################################################
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Loads meshes on a worker thread with its own OpenGL context
+ *
+ * The worker parses the files (or maps their cache) and uploads the buffers on a hidden
+ * context sharing objects with the rendering one, then inserts a fence. The returned
+ * meshes can be used right away: drawing them does nothing until the fence signals, at
+ * which point the render thread creates their VAOs (those are not shared). A file that
+ * cannot be imported is logged and its mesh reports has_failed(), it is never drawn.
+ *
+ * The shared context is typically an invisible window created after the main one:
+ * @code
+ * Nyx::Nyx_Window loader_window("Loader", NULL, window.getWindowPtr(), false);
+ * glfwMakeContextCurrent(window.getWindowPtr());
+ * Helios::Mesh_Loader loader(loader_window.getWindowPtr());
+ * std::shared_ptr<Helios::Mesh> mesh = loader.load("Assets/dragon.obj");
+ * @endcode
+ * The context must not be current on any other thread.
+*/
+class Mesh_Loader
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        /**
+         * @brief A mesh waiting to be loaded
+         *
+        */
+        struct Load_Job
+        {
+            std::shared_ptr<Mesh> mesh; //!< The mesh to fill
+            std::string file_path;      //!< File to import
+            uint flags;                 //!< Mesh_Flags to import the file with
+        };
+
+        GLFWwindow *context;                //!< Hidden window owning the worker context
+        std::thread worker;                 //!< Thread loading the meshes
+        std::mutex jobs_mutex;              //!< Guards jobs and stop
+        std::condition_variable jobs_signal;//!< Wakes the worker up
+        std::condition_variable idle_signal;//!< Signals the end of every load
+        std::deque<Load_Job> jobs;          //!< Meshes waiting to be loaded
+        bool loading;                       //!< Whether the worker is loading a mesh
+        bool stop;                          //!< Asks the worker to exit
+
+        /**
+         * @brief Body of the worker thread
+         *
+        */
+        void worker_loop();
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Start the worker thread
+         *
+         * @param shared_context Window whose context shares objects with the rendering
+         *        context, it will be made current on the worker
+        */
+        Mesh_Loader(GLFWwindow *shared_context);
+        /**
+         * @brief Finish the queued loads and stop the worker thread
+         *
+        */
+        ~Mesh_Loader();
+
+        Mesh_Loader(const Mesh_Loader&) = delete;
+        Mesh_Loader &operator=(const Mesh_Loader&) = delete;
+
+//──── Loading ───────────────────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Queue a mesh to be loaded
+         *
+         * @param file_path Path to a wavefront (.obj) file
+         * @param flags Combination of Mesh_Flags
+         * @param assets Registry the material textures are acquired from, it must not
+         *        be destroyed before the load is done (see wait())
+         * @return std::shared_ptr<Mesh> The mesh, resident once Mesh::is_resident()
+        */
+        std::shared_ptr<Mesh> load(std::string file_path,
+            uint flags = HELIOS_MESH_DEFAULT, Asset_Registry *assets = NULL);
+        /**
+         * @brief Block until every queued load is done
+         *
+        */
+        void wait();
+        /**
+         * @brief Get the number of meshes waiting to be loaded
+         *
+        */
+        uint getPendingCount();
+};
+
+}//Close Helios namespace
+//########################################################################################
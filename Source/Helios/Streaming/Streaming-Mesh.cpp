@@ -0,0 +1,352 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Implementation of out of core meshes streamed from paged files
+ *
+ * @file Streaming-Mesh.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+
+#include "Streaming-Mesh.hpp"
+#include "Camera.hpp"
+#include "Meshlets.hpp"
+
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace glm;
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                    Helping Methods                                   *
+ *                                                                                      */
+//========================================================================================
+/**
+ * @brief Read an exact number of bytes at an offset of a file
+ *
+ * @param file_descriptor The file to read from
+ * @param destination Where to write the bytes
+ * @param size Number of bytes to read
+ * @param offset Offset in bytes in the file
+ * @return true If every byte was read
+*/
+bool static read_at(int file_descriptor, void *destination, size_t size, uint64_t offset)
+{
+    char *cursor = (char*) destination;
+    while(size > 0)
+    {
+        ssize_t bytes = pread(file_descriptor, cursor, size, offset);
+        if(bytes < 0 && errno == EINTR)
+            continue;
+        if(bytes <= 0)
+            return false;
+        cursor += bytes;
+        offset += bytes;
+        size -= bytes;
+    }
+    return true;
+}
+//########################################################################################
+
+namespace Helios{
+
+//========================================================================================
+/*                                                                                      *
+ *                                 Streaming Mesh Class                                 *
+ *                                                                                      */
+//========================================================================================
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+Streaming_Mesh::Streaming_Mesh(string path, uint64_t memory_budget)
+{
+    file_path = path;
+    file_descriptor = open(file_path.c_str(), O_RDONLY);
+    bool valid = file_descriptor >= 0 &&
+        read_at(file_descriptor, &header, sizeof(header), 0) &&
+        memcmp(header.magic, "HPAG", 4) == 0 && header.version == HPAGE_VERSION &&
+        header.vertex_stride == sizeof(Interleaved_Vertex);
+    if(valid)
+    {
+        pages.resize(header.page_count);
+        valid = read_at(file_descriptor, pages.data(),
+            pages.size()*sizeof(Paged_Mesh_Page), sizeof(header));
+    }
+    if(!valid)
+    {
+        cerr << "Unable to open paged mesh " << file_path << endl;
+        Log::record_log(string(80,'!') + "\nUnable to open paged mesh " + file_path +
+            "\n" + string(80,'!'));
+        exit(EXIT_FAILURE);   // call system to stop
+    }
+    page_state.assign(pages.size(), PAGE_ABSENT);
+    page_slot.assign(pages.size(), -1);
+
+    //Slots hold any page, keep them aligned so pages can be drawn with a base vertex
+    slot_size = (header.max_page_size + 255) / 256 * 256;
+    uint64_t slot_count = slot_size>0? memory_budget/slot_size : 0;
+    slot_count = std::min(slot_count, uint64_t(pages.size()));
+    if(slot_count == 0 && !pages.empty())
+    {
+        cerr << "Memory budget of " << memory_budget << " bytes can't hold a page of "
+            << file_path << endl;
+        Log::record_log("Memory budget of " + to_string(memory_budget) +
+            " bytes can't hold a page of " + file_path);
+        exit(EXIT_FAILURE);   // call system to stop
+    }
+    slots.assign(slot_count, {-1, 0});
+
+    //Persistently mapped buffer the reader writes the pages into
+    GL_State &state = GL_State::current();
+    glGenVertexArrays(1, &VAO);
+    state.bind_vertex_array(VAO);
+    glObjectLabel(GL_VERTEX_ARRAY, VAO, -1,
+        ("\"" + file_path + " streaming VAO\"").c_str());
+    glGenBuffers(1, &buffer);
+    state.bind_buffer(GL_ARRAY_BUFFER, buffer);
+    glObjectLabel(GL_BUFFER, buffer, -1, ("\"" + file_path + " page buffer\"").c_str());
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GLsizeiptr buffer_size = std::max(slot_count*slot_size, uint64_t(1));
+    glBufferStorage(GL_ARRAY_BUFFER, buffer_size, nullptr, access);
+    mapping = (char*) glMapBufferRange(GL_ARRAY_BUFFER, 0, buffer_size, access);
+
+    //Vertices and indices of the pages live in the same buffer
+    state.bind_buffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    glVertexAttribFormat(0, 3, GL_FLOAT, GL_FALSE,
+        offsetof(Interleaved_Vertex, position));
+    glVertexAttribFormat(1, 3, GL_FLOAT, GL_FALSE, offsetof(Interleaved_Vertex, normal));
+    glVertexAttribFormat(2, 2, GL_FLOAT, GL_FALSE, offsetof(Interleaved_Vertex, uv));
+    for(GLuint location=0; location<3; location++)
+    {
+        glVertexAttribBinding(location, 0);
+        glEnableVertexAttribArray(location);
+    }
+    state.bind_vertex_buffer(0, buffer, 0, sizeof(Interleaved_Vertex));
+
+    frame = 1;
+    completed_frame = 0;
+    in_flight = 0;
+    stop = false;
+    reader = thread(&Streaming_Mesh::reader_loop, this);
+}
+
+Streaming_Mesh::~Streaming_Mesh()
+{
+    {
+        lock_guard<mutex> lock(queue_mutex);
+        stop = true;
+    }
+    queue_signal.notify_all();
+    reader.join();
+
+    for(auto &fence : frame_fences)
+        glDeleteSync(fence.second);
+    GL_State::current().bind_buffer(GL_ARRAY_BUFFER, buffer);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    GL_State::delete_buffers(1, &buffer);
+    GL_State::delete_vertex_arrays(1, &VAO);
+    close(file_descriptor);
+}
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+uint Streaming_Mesh::getResidentCount()
+{
+    uint resident = 0;
+    for(Slot &slot : slots)
+        resident += slot.page >= 0 && page_state[slot.page] == PAGE_RESIDENT;
+    return resident;
+}
+
+//──── Streaming ─────────────────────────────────────────────────────────────────────────
+
+//Read the requested pages into their slots
+void Streaming_Mesh::reader_loop()
+{
+    while(true)
+    {
+        unique_lock<mutex> lock(queue_mutex);
+        queue_signal.wait(lock, [this](){return stop || !requests.empty();});
+        if(stop)
+            return;
+        Load_Request request = requests.front();
+        requests.pop_front();
+        lock.unlock();
+
+        //The mapping is plain memory, no context is needed to write to it
+        const Paged_Mesh_Page &page = pages[request.page];
+        size_t size = page.vertex_count*header.vertex_stride +
+            page.index_count*sizeof(uint16_t);
+        request.ok = read_at(file_descriptor, mapping + request.slot*slot_size, size,
+            page.offset);
+        //The data now lives in the buffer, the kernel does not need to cache it
+        posix_fadvise(file_descriptor, page.offset, size, POSIX_FADV_DONTNEED);
+
+        lock.lock();
+        completed.push_back(request);
+    }
+}
+//Find the frames the GPU is done with
+void Streaming_Mesh::retire_frames()
+{
+    while(!frame_fences.empty())
+    {
+        GLenum status = glClientWaitSync(frame_fences.front().second, 0, 0);
+        if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+        completed_frame = frame_fences.front().first;
+        glDeleteSync(frame_fences.front().second);
+        frame_fences.pop_front();
+    }
+}
+//Mark the pages the reader finished as resident
+void Streaming_Mesh::collect_loads()
+{
+    vector<Load_Request> finished;
+    {
+        lock_guard<mutex> lock(queue_mutex);
+        finished.swap(completed);
+    }
+    for(Load_Request &request : finished)
+    {
+        in_flight--;
+        if(request.ok)
+        {
+            page_state[request.page] = PAGE_RESIDENT;
+            continue;
+        }
+        Log::record_log("Failed to read page " + to_string(request.page) + " of " +
+            file_path);
+        page_state[request.page] = PAGE_FAILED;
+        page_slot[request.page] = -1;
+        slots[request.slot].page = -1;
+    }
+}
+//Pick a free slot or the least recently drawn one
+int Streaming_Mesh::allocate_slot()
+{
+    int best = -1;
+    for(uint s=0; s<slots.size(); s++)
+    {
+        Slot &slot = slots[s];
+        if(slot.page < 0)
+            return s;
+        //Pages drawn this frame or still read by the GPU can't be replaced
+        if(page_state[slot.page] != PAGE_RESIDENT || slot.last_frame >= frame ||
+            slot.last_frame > completed_frame)
+            continue;
+        if(best == -1 || slot.last_frame < slots[best].last_frame)
+            best = s;
+    }
+    if(best != -1)
+    {
+        int evicted = slots[best].page;
+        page_state[evicted] = PAGE_ABSENT;
+        page_slot[evicted] = -1;
+        slots[best].page = -1;
+    }
+    return best;
+}
+
+//──── GPU related methods ───────────────────────────────────────────────────────────────
+
+uint Streaming_Mesh::draw(Camera &camera, const mat4 &model)
+{
+    retire_frames();
+    collect_loads();
+
+    //Pages in the view frustum, nearest first
+    vec4 planes[6];
+    extract_frustum_planes(camera.getPerspectiveMatrix()*camera.getViewMatrix()*model,
+        planes);
+    vec3 eye = vec3(inverse(model)*vec4(camera.getPosition(), 1));
+    vector<pair<float, uint>> visible;
+    for(uint p=0; p<pages.size(); p++)
+    {
+        vec3 center = vec3(pages[p].center[0], pages[p].center[1], pages[p].center[2]);
+        bool inside = true;
+        for(int i=0; i<6 && inside; i++)
+            inside = dot(vec3(planes[i]), center) + planes[i].w >= -pages[p].radius;
+        if(inside)
+            visible.push_back({length(center - eye) - pages[p].radius, p});
+    }
+    sort(visible.begin(), visible.end());
+
+    //Draw what is resident, request what is missing
+    GLsizei stride = header.vertex_stride;
+    vector<GLsizei> counts;
+    vector<const void*> offsets;
+    vector<GLint> base_vertices;
+    vector<uint> missing;
+    for(auto &entry : visible)
+    {
+        uint p = entry.second;
+        if(page_state[p] == PAGE_RESIDENT)
+        {
+            Slot &slot = slots[page_slot[p]];
+            slot.last_frame = frame;
+            uint64_t start = page_slot[p]*slot_size;
+            counts.push_back(pages[p].index_count);
+            offsets.push_back((void*)(start + pages[p].vertex_count*stride));
+            base_vertices.push_back(start/stride);
+        }
+        else if(page_state[p] == PAGE_ABSENT)
+            missing.push_back(p);
+    }
+
+    uint issued = 0;
+    for(uint p : missing)
+    {
+        if(in_flight + issued >= HELIOS_STREAMING_MAX_REQUESTS)
+            break;
+        int slot = allocate_slot();
+        if(slot < 0)
+            break;
+        slots[slot] = {int(p), 0};
+        page_slot[p] = slot;
+        page_state[p] = PAGE_LOADING;
+        {
+            lock_guard<mutex> lock(queue_mutex);
+            requests.push_back({p, uint(slot), false});
+        }
+        issued++;
+    }
+    if(issued > 0)
+    {
+        in_flight += issued;
+        queue_signal.notify_one();
+    }
+
+    GL_State::current().bind_vertex_array(VAO);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, counts.data(), GL_UNSIGNED_SHORT,
+        offsets.data(), counts.size(), base_vertices.data());
+
+    //Slots drawn this frame are reusable once this fence signals
+    frame_fences.push_back({frame, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0)});
+    frame++;
+    return counts.size();
+}
+
+void Streaming_Mesh::load_to_program(Shading_Program *program)
+{
+    //Optional like in Mesh::load_to_program(), -1 locations are ignored
+    static constexpr Uniform_Name scale_uniform("position_scale");
+    static constexpr Uniform_Name offset_uniform("position_offset");
+    GLuint program_id = program->getProgramID();
+    glProgramUniform3f(program_id, program->find_uniform(scale_uniform), 1, 1, 1);
+    glProgramUniform3f(program_id, program->find_uniform(offset_uniform), 0, 0, 0);
+}
+//########################################################################################
+
+}//Helios namespace closing bracket
@@ -0,0 +1,193 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**                                                                                     *
+ * @brief Header declaration of out of core meshes streamed from paged files
+ *
+ * @file Streaming-Mesh.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+ *                                                                                      */
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include "Helios/System-Libraries.hpp"
+#include "Helios-Wrappers.hpp"
+#include "Paged-Mesh.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+//########################################################################################
+
+/**
+ * @brief Default amount of memory in bytes a streaming mesh keeps its pages in
+ *
+*/
+#define HELIOS_STREAMING_BUDGET (256ull << 20)
+/**
+ * @brief Maximum number of pages being read at any time
+ *
+*/
+#define HELIOS_STREAMING_MAX_REQUESTS 8
+
+namespace Helios{
+//========================================================================================
+/*                                                                                      *
+ *                                  Class Declarations                                  *
+ *                                                                                      */
+//========================================================================================
+class Camera;
+/**
+ * @brief A mesh too large for memory, streamed from a .hpage file as it is needed
+ *
+ * The pages are read by a background thread straight into a persistently mapped buffer
+ * divided into slots of the size of the largest page, so the memory used is bounded by
+ * the budget regardless of the size of the file. Every frame the pages in the view
+ * frustum are requested nearest first, the ones that are resident are drawn, and the
+ * least recently drawn pages are evicted to make room once the GPU is done with them.
+*/
+class Streaming_Mesh
+{
+//──── Private Members ───────────────────────────────────────────────────────────────────
+
+    private:
+        //State of a page of the file
+        enum {PAGE_ABSENT=0, PAGE_LOADING, PAGE_RESIDENT, PAGE_FAILED};
+
+        /**
+         * @brief A region of the buffer able to hold any page
+         *
+        */
+        struct Slot
+        {
+            int page;               //!< Page held by the slot, -1 if free
+            uint64_t last_frame;    //!< Last frame in which the page was drawn
+        };
+        /**
+         * @brief Read of a page into a slot
+         *
+        */
+        struct Load_Request
+        {
+            uint page;  //!< Page to read
+            uint slot;  //!< Slot to read it into
+            bool ok;    //!< Set by the reader, whether the read succeeded
+        };
+
+        int file_descriptor;                    //!< The open .hpage file
+        std::string file_path;                  //!< Path to the .hpage file
+        Paged_Mesh_Header header;               //!< Header of the file
+        std::vector<Paged_Mesh_Page> pages;     //!< Page table of the file
+        std::vector<uint8_t> page_state;        //!< State of every page
+        std::vector<int> page_slot;             //!< Slot of every page, -1 if none
+
+        GLuint VAO;                 //!< Vertex array object
+        GLuint buffer;              //!< Buffer holding the vertices and indices of pages
+        char *mapping;              //!< Persistent mapping of the buffer
+        uint64_t slot_size;         //!< Size in bytes of a slot
+        std::vector<Slot> slots;    //!< Slots of the buffer
+
+        uint64_t frame;             //!< Number of the frame being drawn
+        uint64_t completed_frame;   //!< Last frame the GPU finished drawing
+        std::deque<std::pair<uint64_t, GLsync>> frame_fences; //!< Fences of past frames
+
+        std::thread reader;                     //!< Background thread reading pages
+        std::mutex queue_mutex;                 //!< Guards requests, completed and stop
+        std::condition_variable queue_signal;   //!< Wakes the reader up
+        std::deque<Load_Request> requests;      //!< Reads waiting for the reader
+        std::vector<Load_Request> completed;    //!< Reads done by the reader
+        uint in_flight;                         //!< Requests not yet collected
+        bool stop;                              //!< Asks the reader to exit
+
+        /**
+         * @brief Body of the reader thread
+         *
+        */
+        void reader_loop();
+        /**
+         * @brief Advance completed_frame past the frames the GPU finished
+         *
+        */
+        void retire_frames();
+        /**
+         * @brief Make the pages read since the last frame resident
+         *
+        */
+        void collect_loads();
+        /**
+         * @brief Find a slot for a new page, evicting a page if needed
+         *
+         * @return int The slot, -1 if every slot is in use
+        */
+        int allocate_slot();
+
+    public:
+
+//──── Constructors and Destructors ──────────────────────────────────────────────────────
+
+        /**
+         * @brief Open a paged mesh and start its reader thread
+         *
+         * @param file_path Path to a .hpage file (see write_paged_mesh())
+         * @param memory_budget Bytes of buffer memory the pages can occupy
+        */
+        Streaming_Mesh(std::string file_path,
+            uint64_t memory_budget = HELIOS_STREAMING_BUDGET);
+        /**
+         * @brief Stop the reader thread and release the buffer and the file
+         *
+        */
+        ~Streaming_Mesh();
+
+        Streaming_Mesh(const Streaming_Mesh&) = delete;
+        Streaming_Mesh &operator=(const Streaming_Mesh&) = delete;
+
+//──── Getters and Setters ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Get the number of pages of the mesh
+         *
+        */
+        uint inline getPageCount(){return pages.size();}
+        /**
+         * @brief Get the number of pages that fit in the memory budget
+         *
+        */
+        uint inline getSlotCount(){return slots.size();}
+        /**
+         * @brief Get the number of pages currently resident
+         *
+        */
+        uint getResidentCount();
+
+//──── GPU related methods ───────────────────────────────────────────────────────────────
+
+        /**
+         * @brief Stream in the visible pages and draw the ones that are resident
+         *
+         * Must be called once per frame from the thread owning the context.
+         *
+         * @param camera The camera the mesh is drawn from
+         * @param model Model matrix of the mesh
+         * @return uint The number of pages drawn
+        */
+        uint draw(Camera &camera, const glm::mat4 &model = glm::mat4(1));
+        /**
+         * @brief Load the uniforms needed to read the positions of the mesh
+         *
+         * The pages are not quantized, this resets the scale and offset left by other
+         * meshes (see Mesh::load_to_program()).
+         *
+         * @param program The program that will draw the mesh
+        */
+        void load_to_program(Shading_Program *program);
+};
+
+}//Close Helios namespace
+//########################################################################################
@@ -15,8 +15,12 @@
 //========================================================================================
 #include "log.hpp"
 
+#include <mutex>
+
 bool first_call = true;
 std::string LOG_FILE = "log/.log";
+//Serializes writes, worker threads record logs too
+std::mutex log_mutex;
 
 //########################################################################################
 
@@ -49,6 +53,7 @@ void wipe_log()
 //Record a message
 void record_log(std::string message)
 {
+    std::lock_guard<std::mutex> lock(log_mutex);
     if(first_call)
         wipe_log();
 
@@ -64,6 +69,7 @@ void record_log(std::string message)
 }
 void record_log(std::string message, std::string end, int alignment)
 {
+    std::lock_guard<std::mutex> lock(log_mutex);
     if(first_call)
         wipe_log();
 
@@ -90,6 +96,7 @@ void record_log(std::string message, std::string end, int alignment)
 }
 void record_log(std::string message, std::string end, int alignment, char fill)
 {
+    std::lock_guard<std::mutex> lock(log_mutex);
     if(first_call)
         wipe_log();
 
@@ -118,6 +125,7 @@ void record_log(std::string message, std::string end, int alignment, char fill)
 //Record a message and the time of the message
 void record_log_time(std::string message)
 {
+    std::lock_guard<std::mutex> lock(log_mutex);
     if(first_call)
         wipe_log();
 
@@ -0,0 +1,76 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @brief Implementation of the read only memory mapped file
+ *
+ * @file mapped_file.cpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+*/
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                               Function Implementations                               *
+ *                                                                                      */
+//========================================================================================
+
+namespace Helpers{
+
+//Open and map the file
+Mapped_File::Mapped_File(std::string file_path)
+{
+    mapping = nullptr;
+    file_size = 0;
+
+    file_descriptor = open(file_path.c_str(), O_RDONLY);
+    if(file_descriptor < 0)
+        return;
+
+    struct stat info;
+    if(fstat(file_descriptor, &info) != 0)
+    {
+        close(file_descriptor);
+        file_descriptor = -1;
+        return;
+    }
+    //Empty files cannot be mapped, they are simply open and have no data
+    file_size = info.st_size;
+    if(file_size == 0)
+        return;
+
+    mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if(mapping == MAP_FAILED)
+    {
+        mapping = nullptr;
+        file_size = 0;
+        close(file_descriptor);
+        file_descriptor = -1;
+        return;
+    }
+    //The file is read front to back, let the kernel read ahead aggressively
+    madvise(mapping, file_size, MADV_SEQUENTIAL);
+}
+
+//Release the mapping
+Mapped_File::~Mapped_File()
+{
+    if(mapping != nullptr)
+        munmap(mapping, file_size);
+    if(file_descriptor >= 0)
+        close(file_descriptor);
+}
+}//Closing bracket of Helpers namespace
+//########################################################################################
@@ -0,0 +1,75 @@
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+/**
+ * @brief A small header declaring a read only memory mapped file
+ *
+ * @file mapped_file.hpp
+ * @author Camilo Talero
+ * @date 2026-10-17
+*/
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//========================================================================================
+/*                                                                                      *
+ *                                     Include Files                                    *
+ *                                                                                      */
+//========================================================================================
+#pragma once
+
+#include <string>
+#include <cstddef>
+//########################################################################################
+
+//========================================================================================
+/*                                                                                      *
+ *                                   Mapped File Class                                  *
+ *                                                                                      */
+//========================================================================================
+
+namespace Helpers{
+/**
+ * @brief Read only view of an entire file mapped into the address space of the process
+ *
+ * The mapping is released when the object is destroyed. Objects can't be copied.
+*/
+class Mapped_File
+{
+    private:
+        int file_descriptor;    //!< Descriptor of the open file, -1 if not open
+        void *mapping;          //!< Start of the mapped region, nullptr if not mapped
+        size_t file_size;       //!< Size in bytes of the mapped region
+
+    public:
+        /**
+         * @brief Map the file at the given path
+         *
+         * @param file_path Path to the file to map
+        */
+        Mapped_File(std::string file_path);
+        /**
+         * @brief Unmap the file and close its descriptor
+         *
+        */
+        ~Mapped_File();
+
+        Mapped_File(const Mapped_File&) = delete;
+        Mapped_File& operator=(const Mapped_File&) = delete;
+
+        /**
+         * @brief Whether the file was opened and mapped successfully
+         *
+         * An empty file is considered open with a null data pointer.
+        */
+        bool inline is_open(){return file_descriptor >= 0;}
+        /**
+         * @brief Pointer to the first byte of the file
+         *
+        */
+        const char inline *data(){return (const char*)mapping;}
+        /**
+         * @brief Size of the file in bytes
+         *
+        */
+        size_t inline size(){return file_size;}
+};
+}//Closing bracket of Helpers namespace
+//########################################################################################
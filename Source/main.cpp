@@ -26,7 +26,7 @@ using namespace glm;
  *                                         Main                                         *
  *                                                                                      */
 //========================================================================================
-Helios::Mesh *mesh;
+std::shared_ptr<Helios::Mesh> mesh;
 Helios::Camera c;
 Helios::Shading_Program *v;
 Nyx::Nyx_Keyboard* kbd;
@@ -37,13 +37,17 @@ void render()
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     kbd->updateAllKeys();
-    c.load_to_program(v);
+    c.load_to_buffer();
+    mesh->load_to_program(v);
 
     v->use();
-    glEnable(GL_CULL_FACE);
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_BLEND);
-    mesh->draw();
+    //Only the first frame reaches the driver, later ones find the state already set
+    Helios::GL_State &state = Helios::GL_State::current();
+    state.enable(GL_CULL_FACE);
+    state.enable(GL_DEPTH_TEST);
+    state.enable(GL_BLEND);
+    mesh->draw_lod(mesh->select_lod(c, glm::mat4(1)));
+    state.end_frame();
 }
 #define CAM_SPEED 0.001f
 void cursor_position_callback(GLFWwindow* window, double xpos, double ypos)
@@ -88,10 +92,33 @@ void static key_callback(GLFWwindow* window, int key, int scancode, int action,
     	cout << glfwGetVersionString() << endl;
 }
 
-int main()
+/**
+ * @brief Start the example, or only run a benchmark when asked on the command line
+ *
+ * "--benchmark-layouts <mesh.obj>" compares the vertex layouts of the given mesh with
+ * the example's program and exits.
+*/
+int main(int argc, char **argv)
 {
+    string benchmark_mesh = "";
+    for(int arg=1; arg<argc; arg++)
+    {
+        if(string(argv[arg]) != "--benchmark-layouts")
+            continue;
+        if(arg+1 >= argc || !ifstream(argv[arg+1]).good())
+        {
+            cerr << "--benchmark-layouts needs the path of an existing mesh" << endl;
+            return EXIT_FAILURE;
+        }
+        benchmark_mesh = argv[++arg];
+    }
+
     Nyx::NyxInit(NYX_TOLERANCE_HIGH);
     Nyx::Nyx_Window w = Nyx::Nyx_Window("Example", render, NULL, true);
+    //Hidden window sharing objects with w, used to upload meshes in the background
+    Nyx::Nyx_Window loader_window = Nyx::Nyx_Window("Loader", NULL, w.getWindowPtr(),
+        false);
+    glfwMakeContextCurrent(w.getWindowPtr());
 
     w.disable_cursor();
     w.set_callback(cursor_position_callback);
@@ -102,6 +129,11 @@ int main()
     Helios::HeliosInit();
     v = new Helios::Shading_Program("Helios-Shaders/Basic-Vertex.glsl", "",
         "", "", "Helios-Shaders/Basic-Fragment.glsl", "");
+    if(benchmark_mesh != "")
+    {
+        Helios::benchmark_mesh_layouts(benchmark_mesh, v, 100);
+        return EXIT_SUCCESS;
+    }
 
     kbd = new Nyx::Nyx_Keyboard(&w);
     kbd->set_w_func([]()->void{c.translateForward(CAM_SPEED);});
@@ -111,8 +143,11 @@ int main()
     kbd->set_shift_func([]()->void{c.translate(vec3(0,-1,0)*CAM_SPEED);});
     kbd->set_space_func([]()->void{c.translate(vec3(0,1,0)*CAM_SPEED);});
 
-    mesh = new Helios::Mesh("Assets/dragon.obj");
-    Helios::Texture t = Helios::Texture("Assets/tiled_texture.png", GL_TEXTURE_2D);
+    Helios::Mesh_Loader loader(loader_window.getWindowPtr());
+    Helios::Asset_Registry assets(&loader);
+    mesh = assets.getMesh("Assets/dragon.obj", Helios::HELIOS_MESH_LOD);
+    std::shared_ptr<Helios::Texture> texture =
+        assets.getTexture("Assets/tiled_texture.png", GL_TEXTURE_2D);
 
     w.start_loop();
 }